@@ -0,0 +1,314 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// Simple Long Integer Math for C++
+// version 2.0
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// Licensed under the MIT License <http://opensource.org/licenses/MIT>.
+// SPDX-License-Identifier: MIT
+//
+// Copyright (c) 2020-2026 Yury Kalmykov <y_kalmykov@mail.ru>.
+//
+// Permission is hereby  granted, free of charge, to any  person obtaining a copy
+// of this software and associated  documentation files (the "Software"), to deal
+// in the Software  without restriction, including without  limitation the rights
+// to  use, copy,  modify, merge,  publish, distribute,  sublicense, and/or  sell
+// copies  of  the Software,  and  to  permit persons  to  whom  the Software  is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE  IS PROVIDED "AS  IS", WITHOUT WARRANTY  OF ANY KIND,  EXPRESS OR
+// IMPLIED,  INCLUDING BUT  NOT  LIMITED TO  THE  WARRANTIES OF  MERCHANTABILITY,
+// FITNESS FOR  A PARTICULAR PURPOSE AND  NONINFRINGEMENT. IN NO EVENT  SHALL THE
+// AUTHORS  OR COPYRIGHT  HOLDERS  BE  LIABLE FOR  ANY  CLAIM,  DAMAGES OR  OTHER
+// LIABILITY, WHETHER IN AN ACTION OF  CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE  OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+
+#pragma once
+
+#include "long_int.h"
+#include "long_uint.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <limits>
+#include <span>
+#include <tuple>
+#include <type_traits>
+
+namespace slim
+{
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// accumulator class
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+// sum of native integers in a long integer: values are added to a single low word and carries (or
+// borrows of negative values) are counted separately, the counter is folded into the total only
+// by value() and once per 2^fold_bits additions, so no carry ripples through the whole integer
+
+template<typename type_t>
+class accumulator
+{
+    static_assert(is_long_integer_v<type_t>, "accumulator requires long integer type");
+
+public:
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    // type and constant definition
+
+    using native_t = typename type_t::native_array_t::value_type;
+    using value_type = std::conditional_t<is_signed_v<type_t>, make_signed_t<native_t>, native_t>;
+
+    // counter can't overflow before this number of additions
+    static constexpr uint_t fold_bits = bit_count_v<native_t> - 2;
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    // construction/destruction
+
+    constexpr accumulator() noexcept = default;
+    constexpr explicit accumulator(const type_t& total) noexcept;
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    // public methods
+
+    constexpr accumulator& operator+=(value_type value) noexcept;
+    constexpr accumulator& operator+=(const accumulator& that) noexcept;
+
+    // add all values, halves of values are summed separately by loops that compilers vectorize
+    constexpr void accumulate(std::span<const value_type> values) noexcept;
+
+    constexpr type_t value() const noexcept;
+
+private:
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    // private methods
+
+    constexpr void fold() noexcept;
+
+private:
+    type_t total = 0;
+    native_t low = 0;
+    value_type carries = 0;
+    native_t steps = 0;
+};
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// standalone methods
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+template<typename type_t, std::enable_if_t<is_long_integer_v<type_t>, int> = 0>
+constexpr type_t accumulate(std::span<const typename accumulator<type_t>::value_type> values) noexcept;
+
+// exact sum of products of native integers: double width products are added to two words and
+// carries out of them are counted and folded once per block; the result doesn't depend on the
+// order of additions, int256_t holds sums of up to 2^127 products of int64_t without overflow
+
+template<typename type_t = int256_t, std::enable_if_t<is_long_integer_v<type_t> && std::tuple_size_v<typename type_t::native_array_t> >= 4, int> = 0>
+constexpr type_t dot_exact(std::span<const typename accumulator<type_t>::value_type> values1, std::span<const typename accumulator<type_t>::value_type> values2) noexcept;
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// accumulator class
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// construction/destruction
+
+template<typename type_t>
+constexpr accumulator<type_t>::accumulator(const type_t& total) noexcept
+: total(total)
+{
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// public methods
+
+template<typename type_t>
+constexpr accumulator<type_t>& accumulator<type_t>::operator+=(value_type value) noexcept
+{
+    const native_t digit = static_cast<native_t>(value);
+
+    low += digit;
+    carries += static_cast<value_type>(low < digit);
+
+    // negative value is its two's complement digit minus one unit of the next digit
+
+    if constexpr (is_signed_v<type_t>)
+        carries -= static_cast<value_type>(value < 0);
+
+    if (++steps == native_t(1) << fold_bits)
+        fold();
+
+    return *this;
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+template<typename type_t>
+constexpr accumulator<type_t>& accumulator<type_t>::operator+=(const accumulator& that) noexcept
+{
+    total += that.value();
+
+    return *this;
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+template<typename type_t>
+constexpr void accumulator<type_t>::accumulate(std::span<const value_type> values) noexcept
+{
+    // low and high halves of digits are summed as unsigned integers and negative values are
+    // counted by sign bits, all three are plain reductions without arithmetic shifts; blocks are
+    // short enough for sums of halves not to overflow
+
+    constexpr uint_t half_bits = bit_count_v<native_t> / 2;
+    constexpr native_t half_mask = static_cast<native_t>(native_t(1) << half_bits) - 1;
+    constexpr size_t block_size = size_t(1) << (half_bits - 1);
+
+    for (size_t first = 0; first < values.size(); first += block_size) {
+
+        const std::span<const value_type> block = values.subspan(first, std::min(block_size, values.size() - first));
+
+        native_t low_sum = 0;
+        native_t high_sum = 0;
+        native_t negative_count = 0;
+
+        for (value_type value : block) {
+
+            const native_t digit = static_cast<native_t>(value);
+
+            low_sum += static_cast<native_t>(digit & half_mask);
+            high_sum += static_cast<native_t>(digit >> half_bits);
+            negative_count += static_cast<native_t>(digit >> (bit_count_v<native_t> - 1));
+        }
+
+        total += type_t(low_sum);
+        total += type_t(high_sum) << half_bits;
+
+        if constexpr (is_signed_v<type_t>)
+            total -= type_t(negative_count) << bit_count_v<native_t>;
+    }
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+template<typename type_t>
+constexpr type_t accumulator<type_t>::value() const noexcept
+{
+    accumulator result = *this;
+    result.fold();
+
+    return result.total;
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// private methods
+
+template<typename type_t>
+constexpr void accumulator<type_t>::fold() noexcept
+{
+    total += type_t(low);
+    total += type_t(carries) << bit_count_v<native_t>;
+
+    low = 0;
+    carries = 0;
+    steps = 0;
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// standalone methods
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+template<typename type_t, std::enable_if_t<is_long_integer_v<type_t>, int>>
+constexpr type_t accumulate(std::span<const typename accumulator<type_t>::value_type> values) noexcept
+{
+    accumulator<type_t> result;
+    result.accumulate(values);
+
+    return result.value();
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+template<typename type_t, std::enable_if_t<is_long_integer_v<type_t> && std::tuple_size_v<typename type_t::native_array_t> >= 4, int>>
+constexpr type_t dot_exact(std::span<const typename accumulator<type_t>::value_type> values1, std::span<const typename accumulator<type_t>::value_type> values2) noexcept
+{
+    using native_t = typename type_t::native_array_t::value_type;
+    using value_t = typename accumulator<type_t>::value_type;
+
+    assert(values1.size() == values2.size());
+
+    // counter changes at most by two per product
+
+    constexpr size_t block_size = static_cast<size_t>(std::min<uintmax_t>(uintmax_t(1) << (bit_count_v<native_t> - 3), std::numeric_limits<size_t>::max()));
+
+    type_t result = 0;
+
+    for (size_t first = 0; first < values1.size(); first += block_size) {
+
+        const size_t last = first + std::min(block_size, values1.size() - first);
+
+        native_t low = 0;
+        native_t middle = 0;
+        value_t carries = 0;
+
+        for (size_t n = first; n < last; ++n) {
+
+            native_t product_lo = static_cast<native_t>(values1[n]);
+            native_t product_hi = mul(product_lo, static_cast<native_t>(values2[n]));
+
+            // high digit of the signed product is the unsigned one minus the other operand of
+            // every negative operand
+
+            if constexpr (is_signed_v<type_t>) {
+
+                product_hi -= values1[n] < 0 ? static_cast<native_t>(values2[n]) : native_t(0);
+                product_hi -= values2[n] < 0 ? static_cast<native_t>(values1[n]) : native_t(0);
+            }
+
+            low += product_lo;
+
+            const native_t carry = low < product_lo;
+
+            middle += carry;
+            carries += static_cast<value_t>(middle < carry);
+            middle += product_hi;
+            carries += static_cast<value_t>(middle < product_hi);
+
+            if constexpr (is_signed_v<type_t>)
+                carries -= static_cast<value_t>(static_cast<value_t>(product_hi) < 0);
+        }
+
+        result += type_t(low);
+        result += type_t(middle) << bit_count_v<native_t>;
+        result += type_t(carries) << (2 * bit_count_v<native_t>);
+    }
+
+    return result;
+}
+
+} // namespace slim
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// End of long_accumulator.h
+////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,592 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// Simple Long Integer Math for C++
+// version 2.0
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// Licensed under the MIT License <http://opensource.org/licenses/MIT>.
+// SPDX-License-Identifier: MIT
+//
+// Copyright (c) 2020-2026 Yury Kalmykov <y_kalmykov@mail.ru>.
+//
+// Permission is hereby  granted, free of charge, to any  person obtaining a copy
+// of this software and associated  documentation files (the "Software"), to deal
+// in the Software  without restriction, including without  limitation the rights
+// to  use, copy,  modify, merge,  publish, distribute,  sublicense, and/or  sell
+// copies  of  the Software,  and  to  permit persons  to  whom  the Software  is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE  IS PROVIDED "AS  IS", WITHOUT WARRANTY  OF ANY KIND,  EXPRESS OR
+// IMPLIED,  INCLUDING BUT  NOT  LIMITED TO  THE  WARRANTIES OF  MERCHANTABILITY,
+// FITNESS FOR  A PARTICULAR PURPOSE AND  NONINFRINGEMENT. IN NO EVENT  SHALL THE
+// AUTHORS  OR COPYRIGHT  HOLDERS  BE  LIABLE FOR  ANY  CLAIM,  DAMAGES OR  OTHER
+// LIABILITY, WHETHER IN AN ACTION OF  CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE  OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+#pragma once
+
+#include "long_uint.h"
+
+#include <array>
+#include <span>
+
+namespace slim
+{
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// long_uint_batch class
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+// fixed number of unsigned integers stored limb-planar: limb k of all lanes is contiguous, so that
+// lane loops of the kernels are compiled into vector instructions with lane-wise carries
+
+template<typename native_t, uint_t size, uint_t count>
+class long_uint_batch
+{
+public:
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    // type and constant definition
+
+    using value_type = long_uint_t<native_t, size>;
+    using lane_array_t = std::array<native_t, count>;
+    using limb_array_t = std::array<lane_array_t, size>;
+
+    static constexpr uint_t lane_count = count;
+
+    static_assert(count > 0, "batch must have at least one lane.");
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    // construction/destruction
+
+    constexpr long_uint_batch() noexcept = default;
+    constexpr long_uint_batch(const long_uint_batch& that) noexcept = default;
+    constexpr long_uint_batch(long_uint_batch&& that) noexcept = default;
+    explicit constexpr long_uint_batch(const value_type& value) noexcept;
+    explicit constexpr long_uint_batch(std::span<const value_type, count> values) noexcept;
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    // public methods
+
+    constexpr void swap(long_uint_batch& that) noexcept;
+    constexpr long_uint_batch& operator=(const long_uint_batch& that) noexcept = default;
+    constexpr long_uint_batch& operator=(long_uint_batch&& that) noexcept = default;
+
+    constexpr value_type get(uint_t lane) const noexcept;
+    constexpr void set(uint_t lane, const value_type& value) noexcept;
+    constexpr void gather(std::span<const value_type, count> values) noexcept;
+    constexpr void scatter(std::span<value_type, count> values) const noexcept;
+
+    constexpr bool operator==(const long_uint_batch& that) const noexcept;
+    constexpr bool operator!=(const long_uint_batch& that) const noexcept;
+    constexpr long_uint_batch& operator+=(const long_uint_batch& that) noexcept;
+    constexpr long_uint_batch operator+(const long_uint_batch& that) const noexcept;
+    constexpr long_uint_batch& operator-=(const long_uint_batch& that) noexcept;
+    constexpr long_uint_batch operator-(const long_uint_batch& that) const noexcept;
+    constexpr long_uint_batch& operator*=(const long_uint_batch& that) noexcept;
+    constexpr long_uint_batch operator*(const long_uint_batch& that) const noexcept;
+    constexpr long_uint_batch& operator&=(const long_uint_batch& that) noexcept;
+    constexpr long_uint_batch operator&(const long_uint_batch& that) const noexcept;
+    constexpr long_uint_batch& operator|=(const long_uint_batch& that) noexcept;
+    constexpr long_uint_batch operator|(const long_uint_batch& that) const noexcept;
+    constexpr long_uint_batch& operator^=(const long_uint_batch& that) noexcept;
+    constexpr long_uint_batch operator^(const long_uint_batch& that) const noexcept;
+    constexpr long_uint_batch operator~() const noexcept;
+    constexpr long_uint_batch& operator<<=(uint_t shift) noexcept;
+    constexpr long_uint_batch operator<<(uint_t shift) const noexcept;
+    constexpr long_uint_batch& operator>>=(uint_t shift) noexcept;
+    constexpr long_uint_batch operator>>(uint_t shift) const noexcept;
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    // data members
+
+    limb_array_t limbs;
+};
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// standalone methods
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+// multiply lanes, keeping only the lower digits of products
+
+template<typename native_t, uint_t size, uint_t count>
+constexpr long_uint_batch<native_t, size, count> mul_low(const long_uint_batch<native_t, size, count>& value1, const long_uint_batch<native_t, size, count>& value2) noexcept;
+
+// compare lanes, returning -1, 0 or 1 for each lane
+
+template<typename native_t, uint_t size, uint_t count>
+constexpr std::array<int, count> compare(const long_uint_batch<native_t, size, count>& value1, const long_uint_batch<native_t, size, count>& value2) noexcept;
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// long_uint_batch class
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// construction/destruction
+
+template<typename native_t, uint_t size, uint_t count>
+constexpr long_uint_batch<native_t, size, count>::long_uint_batch(const value_type& value) noexcept
+{
+    for (uint_t k = 0; k < size; ++k)
+        limbs[k].fill(value.digits[k]);
+}
+
+template<typename native_t, uint_t size, uint_t count>
+constexpr long_uint_batch<native_t, size, count>::long_uint_batch(std::span<const value_type, count> values) noexcept
+{
+    gather(values);
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// public methods
+
+template<typename native_t, uint_t size, uint_t count>
+constexpr void long_uint_batch<native_t, size, count>::swap(long_uint_batch& that) noexcept
+{
+    using std::swap;
+
+    swap(limbs, that.limbs);
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+template<typename native_t, uint_t size, uint_t count>
+constexpr typename long_uint_batch<native_t, size, count>::value_type long_uint_batch<native_t, size, count>::get(uint_t lane) const noexcept
+{
+    assert(lane < count);
+
+    value_type result;
+
+    for (uint_t k = 0; k < size; ++k)
+        result.digits[k] = limbs[k][lane];
+
+    return result;
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+template<typename native_t, uint_t size, uint_t count>
+constexpr void long_uint_batch<native_t, size, count>::set(uint_t lane, const value_type& value) noexcept
+{
+    assert(lane < count);
+
+    for (uint_t k = 0; k < size; ++k)
+        limbs[k][lane] = value.digits[k];
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+template<typename native_t, uint_t size, uint_t count>
+constexpr void long_uint_batch<native_t, size, count>::gather(std::span<const value_type, count> values) noexcept
+{
+    for (uint_t lane = 0; lane < count; ++lane)
+        set(lane, values[lane]);
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+template<typename native_t, uint_t size, uint_t count>
+constexpr void long_uint_batch<native_t, size, count>::scatter(std::span<value_type, count> values) const noexcept
+{
+    for (uint_t lane = 0; lane < count; ++lane)
+        values[lane] = get(lane);
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+template<typename native_t, uint_t size, uint_t count>
+constexpr bool long_uint_batch<native_t, size, count>::operator==(const long_uint_batch& that) const noexcept
+{
+    return limbs == that.limbs;
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+template<typename native_t, uint_t size, uint_t count>
+constexpr bool long_uint_batch<native_t, size, count>::operator!=(const long_uint_batch& that) const noexcept
+{
+    return !(*this == that);
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+template<typename native_t, uint_t size, uint_t count>
+constexpr long_uint_batch<native_t, size, count>& long_uint_batch<native_t, size, count>::operator+=(const long_uint_batch& that) noexcept
+{
+    constexpr uint_t sign_shift = bit_count_v<native_t> - 1;
+
+    // carries are kept per lane as 0 or 1 and derived from the most significant bits of operands
+    // and result, compilers turn comparisons into adc or setc, which don't vectorize; each row
+    // is computed into a local array so that the stores can't alias the next loads
+
+    lane_array_t carry{};
+
+    for (uint_t k = 0; k < size; ++k) {
+
+        lane_array_t row;
+
+        for (uint_t lane = 0; lane < count; ++lane) {
+
+            const native_t value1 = limbs[k][lane];
+            const native_t value2 = that.limbs[k][lane];
+            const native_t result = static_cast<native_t>(value1 + value2 + carry[lane]);
+
+            carry[lane] = static_cast<native_t>(((value1 & value2) | ((value1 | value2) & ~result)) >> sign_shift);
+            row[lane] = result;
+        }
+
+        limbs[k] = row;
+    }
+
+    return *this;
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+template<typename native_t, uint_t size, uint_t count>
+constexpr long_uint_batch<native_t, size, count> long_uint_batch<native_t, size, count>::operator+(const long_uint_batch& that) const noexcept
+{
+    long_uint_batch result = *this;
+
+    return result += that;
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+template<typename native_t, uint_t size, uint_t count>
+constexpr long_uint_batch<native_t, size, count>& long_uint_batch<native_t, size, count>::operator-=(const long_uint_batch& that) noexcept
+{
+    constexpr uint_t sign_shift = bit_count_v<native_t> - 1;
+
+    lane_array_t borrow{};
+
+    for (uint_t k = 0; k < size; ++k) {
+
+        lane_array_t row;
+
+        for (uint_t lane = 0; lane < count; ++lane) {
+
+            const native_t value1 = limbs[k][lane];
+            const native_t value2 = that.limbs[k][lane];
+            const native_t result = static_cast<native_t>(value1 - value2 - borrow[lane]);
+
+            borrow[lane] = static_cast<native_t>(((~value1 & value2) | (~(value1 ^ value2) & result)) >> sign_shift);
+            row[lane] = result;
+        }
+
+        limbs[k] = row;
+    }
+
+    return *this;
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+template<typename native_t, uint_t size, uint_t count>
+constexpr long_uint_batch<native_t, size, count> long_uint_batch<native_t, size, count>::operator-(const long_uint_batch& that) const noexcept
+{
+    long_uint_batch result = *this;
+
+    return result -= that;
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+template<typename native_t, uint_t size, uint_t count>
+constexpr long_uint_batch<native_t, size, count>& long_uint_batch<native_t, size, count>::operator*=(const long_uint_batch& that) noexcept
+{
+    return *this = mul_low(*this, that);
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+template<typename native_t, uint_t size, uint_t count>
+constexpr long_uint_batch<native_t, size, count> long_uint_batch<native_t, size, count>::operator*(const long_uint_batch& that) const noexcept
+{
+    return mul_low(*this, that);
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+template<typename native_t, uint_t size, uint_t count>
+constexpr long_uint_batch<native_t, size, count>& long_uint_batch<native_t, size, count>::operator&=(const long_uint_batch& that) noexcept
+{
+    for (uint_t k = 0; k < size; ++k)
+        for (uint_t lane = 0; lane < count; ++lane)
+            limbs[k][lane] &= that.limbs[k][lane];
+
+    return *this;
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+template<typename native_t, uint_t size, uint_t count>
+constexpr long_uint_batch<native_t, size, count> long_uint_batch<native_t, size, count>::operator&(const long_uint_batch& that) const noexcept
+{
+    long_uint_batch result = *this;
+
+    return result &= that;
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+template<typename native_t, uint_t size, uint_t count>
+constexpr long_uint_batch<native_t, size, count>& long_uint_batch<native_t, size, count>::operator|=(const long_uint_batch& that) noexcept
+{
+    for (uint_t k = 0; k < size; ++k)
+        for (uint_t lane = 0; lane < count; ++lane)
+            limbs[k][lane] |= that.limbs[k][lane];
+
+    return *this;
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+template<typename native_t, uint_t size, uint_t count>
+constexpr long_uint_batch<native_t, size, count> long_uint_batch<native_t, size, count>::operator|(const long_uint_batch& that) const noexcept
+{
+    long_uint_batch result = *this;
+
+    return result |= that;
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+template<typename native_t, uint_t size, uint_t count>
+constexpr long_uint_batch<native_t, size, count>& long_uint_batch<native_t, size, count>::operator^=(const long_uint_batch& that) noexcept
+{
+    for (uint_t k = 0; k < size; ++k)
+        for (uint_t lane = 0; lane < count; ++lane)
+            limbs[k][lane] ^= that.limbs[k][lane];
+
+    return *this;
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+template<typename native_t, uint_t size, uint_t count>
+constexpr long_uint_batch<native_t, size, count> long_uint_batch<native_t, size, count>::operator^(const long_uint_batch& that) const noexcept
+{
+    long_uint_batch result = *this;
+
+    return result ^= that;
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+template<typename native_t, uint_t size, uint_t count>
+constexpr long_uint_batch<native_t, size, count> long_uint_batch<native_t, size, count>::operator~() const noexcept
+{
+    long_uint_batch result;
+
+    for (uint_t k = 0; k < size; ++k)
+        for (uint_t lane = 0; lane < count; ++lane)
+            result.limbs[k][lane] = static_cast<native_t>(~limbs[k][lane]);
+
+    return result;
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+template<typename native_t, uint_t size, uint_t count>
+constexpr long_uint_batch<native_t, size, count>& long_uint_batch<native_t, size, count>::operator<<=(uint_t shift) noexcept
+{
+    constexpr uint_t native_bits = bit_count_v<native_t>;
+
+    const uint_t limb_shift = shift / native_bits;
+    const uint_t bit_shift = shift % native_bits;
+
+    // shift is the same for all lanes, so that branches stay outside of lane loops
+
+    for (uint_t k = size; k > 0; --k) {
+
+        lane_array_t& result = limbs[k - 1];
+
+        if (k - 1 < limb_shift) {
+
+            result.fill(native_t(0));
+            continue;
+        }
+
+        const lane_array_t& high = limbs[k - 1 - limb_shift];
+
+        if (bit_shift == 0)
+            result = high;
+        else if (k - 1 == limb_shift) {
+
+            for (uint_t lane = 0; lane < count; ++lane)
+                result[lane] = static_cast<native_t>(high[lane] << bit_shift);
+
+        } else {
+
+            const lane_array_t& low = limbs[k - 2 - limb_shift];
+
+            for (uint_t lane = 0; lane < count; ++lane)
+                result[lane] = static_cast<native_t>((high[lane] << bit_shift) | (low[lane] >> (native_bits - bit_shift)));
+        }
+    }
+
+    return *this;
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+template<typename native_t, uint_t size, uint_t count>
+constexpr long_uint_batch<native_t, size, count> long_uint_batch<native_t, size, count>::operator<<(uint_t shift) const noexcept
+{
+    long_uint_batch result = *this;
+
+    return result <<= shift;
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+template<typename native_t, uint_t size, uint_t count>
+constexpr long_uint_batch<native_t, size, count>& long_uint_batch<native_t, size, count>::operator>>=(uint_t shift) noexcept
+{
+    constexpr uint_t native_bits = bit_count_v<native_t>;
+
+    const uint_t limb_shift = shift / native_bits;
+    const uint_t bit_shift = shift % native_bits;
+
+    for (uint_t k = 0; k < size; ++k) {
+
+        lane_array_t& result = limbs[k];
+
+        if (k + limb_shift >= size) {
+
+            result.fill(native_t(0));
+            continue;
+        }
+
+        const lane_array_t& low = limbs[k + limb_shift];
+
+        if (bit_shift == 0)
+            result = low;
+        else if (k + limb_shift + 1 == size) {
+
+            for (uint_t lane = 0; lane < count; ++lane)
+                result[lane] = static_cast<native_t>(low[lane] >> bit_shift);
+
+        } else {
+
+            const lane_array_t& high = limbs[k + limb_shift + 1];
+
+            for (uint_t lane = 0; lane < count; ++lane)
+                result[lane] = static_cast<native_t>((low[lane] >> bit_shift) | (high[lane] << (native_bits - bit_shift)));
+        }
+    }
+
+    return *this;
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+template<typename native_t, uint_t size, uint_t count>
+constexpr long_uint_batch<native_t, size, count> long_uint_batch<native_t, size, count>::operator>>(uint_t shift) const noexcept
+{
+    long_uint_batch result = *this;
+
+    return result >>= shift;
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// standalone methods
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+template<typename native_t, uint_t size, uint_t count>
+constexpr long_uint_batch<native_t, size, count> mul_low(const long_uint_batch<native_t, size, count>& value1, const long_uint_batch<native_t, size, count>& value2) noexcept
+{
+    using lane_array_t = typename long_uint_batch<native_t, size, count>::lane_array_t;
+
+    long_uint_batch<native_t, size, count> result(long_uint_t<native_t, size>(0U));
+
+    // schoolbook multiplication, the portable half word mulc is used because it vectorizes
+
+    for (uint_t i = 0; i < size; ++i) {
+
+        lane_array_t carry{};
+
+        for (uint_t j = 0; i + j < size; ++j) {
+
+            lane_array_t& digits = result.limbs[i + j];
+
+            for (uint_t lane = 0; lane < count; ++lane) {
+
+                native_t product = value1.limbs[i][lane];
+                native_t high = mulc<native_t>(product, value2.limbs[j][lane], carry[lane]);
+
+                digits[lane] = static_cast<native_t>(digits[lane] + product);
+                high = static_cast<native_t>(high + (digits[lane] < product));
+                carry[lane] = high;
+            }
+        }
+    }
+
+    return result;
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+template<typename native_t, uint_t size, uint_t count>
+constexpr std::array<int, count> compare(const long_uint_batch<native_t, size, count>& value1, const long_uint_batch<native_t, size, count>& value2) noexcept
+{
+    std::array<int, count> result{};
+
+    // more significant limbs override the result of less significant ones
+
+    for (uint_t k = 0; k < size; ++k) {
+
+        for (uint_t lane = 0; lane < count; ++lane) {
+
+            const int order = int(value1.limbs[k][lane] > value2.limbs[k][lane]) - int(value1.limbs[k][lane] < value2.limbs[k][lane]);
+            result[lane] = order != 0 ? order : result[lane];
+        }
+    }
+
+    return result;
+}
+
+} // namespace slim
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// End of long_batch.h
+////////////////////////////////////////////////////////////////////////////////////////////////////
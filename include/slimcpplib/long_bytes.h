@@ -0,0 +1,263 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// Simple Long Integer Math for C++
+// version 2.0
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// Licensed under the MIT License <http://opensource.org/licenses/MIT>.
+// SPDX-License-Identifier: MIT
+//
+// Copyright (c) 2020-2026 Yury Kalmykov <y_kalmykov@mail.ru>.
+//
+// Permission is hereby  granted, free of charge, to any  person obtaining a copy
+// of this software and associated  documentation files (the "Software"), to deal
+// in the Software  without restriction, including without  limitation the rights
+// to  use, copy,  modify, merge,  publish, distribute,  sublicense, and/or  sell
+// copies  of  the Software,  and  to  permit persons  to  whom  the Software  is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE  IS PROVIDED "AS  IS", WITHOUT WARRANTY  OF ANY KIND,  EXPRESS OR
+// IMPLIED,  INCLUDING BUT  NOT  LIMITED TO  THE  WARRANTIES OF  MERCHANTABILITY,
+// FITNESS FOR  A PARTICULAR PURPOSE AND  NONINFRINGEMENT. IN NO EVENT  SHALL THE
+// AUTHORS  OR COPYRIGHT  HOLDERS  BE  LIABLE FOR  ANY  CLAIM,  DAMAGES OR  OTHER
+// LIABILITY, WHETHER IN AN ACTION OF  CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE  OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+#pragma once
+
+#include "long_uint.h"
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <cstring>
+#include <span>
+#include <utility>
+
+namespace slim
+{
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// standalone methods
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+// serialize into and deserialize from little-endian or big-endian byte order of the whole integer
+
+template<typename type_t, std::enable_if_t<is_long_integer_v<type_t>, int> = 0>
+constexpr void to_bytes_le(const type_t& value, std::span<std::byte, byte_count_v<type_t>> bytes) noexcept;
+template<typename type_t, std::enable_if_t<is_long_integer_v<type_t>, int> = 0>
+constexpr void to_bytes_be(const type_t& value, std::span<std::byte, byte_count_v<type_t>> bytes) noexcept;
+template<typename type_t, std::enable_if_t<is_long_integer_v<type_t>, int> = 0>
+constexpr type_t from_bytes_le(std::span<const std::byte, byte_count_v<type_t>> bytes) noexcept;
+template<typename type_t, std::enable_if_t<is_long_integer_v<type_t>, int> = 0>
+constexpr type_t from_bytes_be(std::span<const std::byte, byte_count_v<type_t>> bytes) noexcept;
+
+// bulk versions, size of bytes must be equal to size of values multiplied by byte_count_v<type_t>
+
+template<typename type_t, size_t extent, std::enable_if_t<is_long_integer_v<std::remove_const_t<type_t>>, int> = 0>
+void to_bytes_le(std::span<type_t, extent> values, std::span<std::byte> bytes) noexcept;
+template<typename type_t, size_t extent, std::enable_if_t<is_long_integer_v<std::remove_const_t<type_t>>, int> = 0>
+void to_bytes_be(std::span<type_t, extent> values, std::span<std::byte> bytes) noexcept;
+template<typename type_t, size_t extent, std::enable_if_t<is_long_integer_v<type_t>, int> = 0>
+void from_bytes_le(std::span<const std::byte> bytes, std::span<type_t, extent> values) noexcept;
+template<typename type_t, size_t extent, std::enable_if_t<is_long_integer_v<type_t>, int> = 0>
+void from_bytes_be(std::span<const std::byte> bytes, std::span<type_t, extent> values) noexcept;
+
+namespace impl
+{
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// standalone helper methods
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+template<typename type_t, std::enable_if_t<is_unsigned_v<type_t>, int> = 0>
+constexpr type_t byte_swap(type_t value) noexcept;
+template<typename native_t, size_t size>
+constexpr std::array<native_t, size> to_little_endian(const std::array<native_t, size>& digits) noexcept;
+template<typename native_t, size_t size>
+constexpr std::array<native_t, size> to_big_endian(const std::array<native_t, size>& digits) noexcept;
+
+} // namespace impl
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// standalone methods
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+template<typename type_t, std::enable_if_t<is_long_integer_v<type_t>, int>>
+constexpr void to_bytes_le(const type_t& value, std::span<std::byte, byte_count_v<type_t>> bytes) noexcept
+{
+    const auto buffer = std::bit_cast<std::array<std::byte, byte_count_v<type_t>>>(impl::to_little_endian(value.digits));
+
+    std::copy(buffer.begin(), buffer.end(), bytes.begin());
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+template<typename type_t, std::enable_if_t<is_long_integer_v<type_t>, int>>
+constexpr void to_bytes_be(const type_t& value, std::span<std::byte, byte_count_v<type_t>> bytes) noexcept
+{
+    const auto buffer = std::bit_cast<std::array<std::byte, byte_count_v<type_t>>>(impl::to_big_endian(value.digits));
+
+    std::copy(buffer.begin(), buffer.end(), bytes.begin());
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+template<typename type_t, std::enable_if_t<is_long_integer_v<type_t>, int>>
+constexpr type_t from_bytes_le(std::span<const std::byte, byte_count_v<type_t>> bytes) noexcept
+{
+    using native_array_t = typename type_t::native_array_t;
+
+    std::array<std::byte, byte_count_v<type_t>> buffer;
+    std::copy(bytes.begin(), bytes.end(), buffer.begin());
+
+    // byte swapping is its own inverse, so the same conversion restores native digits
+
+    return type_t(impl::to_little_endian(std::bit_cast<native_array_t>(buffer)));
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+template<typename type_t, std::enable_if_t<is_long_integer_v<type_t>, int>>
+constexpr type_t from_bytes_be(std::span<const std::byte, byte_count_v<type_t>> bytes) noexcept
+{
+    using native_array_t = typename type_t::native_array_t;
+
+    std::array<std::byte, byte_count_v<type_t>> buffer;
+    std::copy(bytes.begin(), bytes.end(), buffer.begin());
+
+    return type_t(impl::to_big_endian(std::bit_cast<native_array_t>(buffer)));
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+template<typename type_t, size_t extent, std::enable_if_t<is_long_integer_v<std::remove_const_t<type_t>>, int>>
+inline void to_bytes_le(std::span<type_t, extent> values, std::span<std::byte> bytes) noexcept
+{
+    assert(bytes.size() == values.size_bytes());
+
+    // digits of little-endian platforms are already in the right order
+
+    if constexpr (std::endian::native == std::endian::little)
+        std::memcpy(bytes.data(), values.data(), values.size_bytes());
+    else {
+
+        for (size_t n = 0; n < values.size(); ++n)
+            to_bytes_le(values[n], bytes.subspan(n * sizeof(type_t)).template first<sizeof(type_t)>());
+    }
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+template<typename type_t, size_t extent, std::enable_if_t<is_long_integer_v<std::remove_const_t<type_t>>, int>>
+inline void to_bytes_be(std::span<type_t, extent> values, std::span<std::byte> bytes) noexcept
+{
+    assert(bytes.size() == values.size_bytes());
+
+    for (size_t n = 0; n < values.size(); ++n)
+        to_bytes_be(values[n], bytes.subspan(n * sizeof(type_t)).template first<sizeof(type_t)>());
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+template<typename type_t, size_t extent, std::enable_if_t<is_long_integer_v<type_t>, int>>
+inline void from_bytes_le(std::span<const std::byte> bytes, std::span<type_t, extent> values) noexcept
+{
+    assert(bytes.size() == values.size_bytes());
+
+    if constexpr (std::endian::native == std::endian::little)
+        std::memcpy(values.data(), bytes.data(), values.size_bytes());
+    else {
+
+        for (size_t n = 0; n < values.size(); ++n)
+            values[n] = from_bytes_le<type_t>(bytes.subspan(n * sizeof(type_t)).template first<sizeof(type_t)>());
+    }
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+template<typename type_t, size_t extent, std::enable_if_t<is_long_integer_v<type_t>, int>>
+inline void from_bytes_be(std::span<const std::byte> bytes, std::span<type_t, extent> values) noexcept
+{
+    assert(bytes.size() == values.size_bytes());
+
+    for (size_t n = 0; n < values.size(); ++n)
+        values[n] = from_bytes_be<type_t>(bytes.subspan(n * sizeof(type_t)).template first<sizeof(type_t)>());
+}
+
+namespace impl
+{
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// standalone helper methods
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+template<typename type_t, std::enable_if_t<is_unsigned_v<type_t>, int>>
+constexpr type_t byte_swap(type_t value) noexcept
+{
+    // unrolled sequence of shifts is recognized by compilers and replaced with a single bswap
+
+    return [value]<size_t... n>(std::index_sequence<n...>) {
+        return static_cast<type_t>((... | static_cast<type_t>(((value >> (n * 8)) & 0xff) << ((sizeof(type_t) - 1 - n) * 8))));
+    }(std::make_index_sequence<sizeof(type_t)>());
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+template<typename native_t, size_t size>
+constexpr std::array<native_t, size> to_little_endian(const std::array<native_t, size>& digits) noexcept
+{
+    if constexpr (std::endian::native == std::endian::little)
+        return digits;
+    else {
+
+        std::array<native_t, size> result;
+
+        for (size_t n = 0; n < size; ++n)
+            result[n] = byte_swap(digits[n]);
+
+        return result;
+    }
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+template<typename native_t, size_t size>
+constexpr std::array<native_t, size> to_big_endian(const std::array<native_t, size>& digits) noexcept
+{
+    // the most significant digit goes first
+
+    std::array<native_t, size> result;
+
+    for (size_t n = 0; n < size; ++n) {
+
+        if constexpr (std::endian::native == std::endian::little)
+            result[n] = byte_swap(digits[size - 1 - n]);
+        else
+            result[n] = digits[size - 1 - n];
+    }
+
+    return result;
+}
+
+} // namespace impl
+} // namespace slim
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// End of long_bytes.h
+////////////////////////////////////////////////////////////////////////////////////////////////////
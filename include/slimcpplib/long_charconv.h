@@ -0,0 +1,855 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// Simple Long Integer Math for C++
+// version 2.0
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// Licensed under the MIT License <http://opensource.org/licenses/MIT>.
+// SPDX-License-Identifier: MIT
+//
+// Copyright (c) 2020-2026 Yury Kalmykov <y_kalmykov@mail.ru>.
+//
+// Permission is hereby  granted, free of charge, to any  person obtaining a copy
+// of this software and associated  documentation files (the "Software"), to deal
+// in the Software  without restriction, including without  limitation the rights
+// to  use, copy,  modify, merge,  publish, distribute,  sublicense, and/or  sell
+// copies  of  the Software,  and  to  permit persons  to  whom  the Software  is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE  IS PROVIDED "AS  IS", WITHOUT WARRANTY  OF ANY KIND,  EXPRESS OR
+// IMPLIED,  INCLUDING BUT  NOT  LIMITED TO  THE  WARRANTIES OF  MERCHANTABILITY,
+// FITNESS FOR  A PARTICULAR PURPOSE AND  NONINFRINGEMENT. IN NO EVENT  SHALL THE
+// AUTHORS  OR COPYRIGHT  HOLDERS  BE  LIABLE FOR  ANY  CLAIM,  DAMAGES OR  OTHER
+// LIABILITY, WHETHER IN AN ACTION OF  CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE  OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+#pragma once
+
+#include "long_fixdiv.h"
+#include "long_uint.h"
+
+#include <array>
+#include <charconv>
+#include <string_view>
+#include <system_error>
+
+namespace slim
+{
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// struct parse_result_t
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+template<typename type_t>
+struct parse_result_t {
+    type_t value{};
+    std::errc ec = std::errc();
+    size_t position = 0;
+};
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// standalone methods
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+// locale-independent conversion with std::to_chars/std::from_chars semantics: base is in [2, 36],
+// output uses lowercase letters, input accepts letters in any case, but neither whitespace,
+// plus sign nor base prefix
+
+template<typename native_t, uint_t size>
+constexpr std::to_chars_result to_chars(char* first, char* last, const long_uint_t<native_t, size>& value, int base = 10) noexcept;
+template<typename native_t, uint_t size>
+constexpr std::to_chars_result to_chars(char* first, char* last, const long_int_t<native_t, size>& value, int base = 10) noexcept;
+template<typename native_t, uint_t size>
+constexpr std::from_chars_result from_chars(const char* first, const char* last, long_uint_t<native_t, size>& value, int base = 10) noexcept;
+template<typename native_t, uint_t size>
+constexpr std::from_chars_result from_chars(const char* first, const char* last, long_int_t<native_t, size>& value, int base = 10) noexcept;
+
+// parse the whole text with the syntax of integer literals: base is detected from 0x, 0b and 0
+// prefixes, digits may be separated by single apostrophes and signed integers accept a minus sign.
+// On failure position points to the unexpected character or to the first digit, that doesn't fit
+
+template<typename type_t, std::enable_if_t<is_long_integer_v<type_t>, int> = 0>
+constexpr parse_result_t<type_t> parse(std::string_view text) noexcept;
+
+namespace impl
+{
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// constants
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+constexpr auto digit_chars = "0123456789abcdefghijklmnopqrstuvwxyz";
+constexpr auto digit_pairs =
+    "00010203040506070809101112131415161718192021222324252627282930313233343536373839"
+    "40414243444546474849505152535455565758596061626364656667686970717273747576777879"
+    "8081828384858687888990919293949596979899";
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// struct decimal_split_t
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+template<typename type_t>
+struct decimal_split_t {
+    long_fixed_divider<type_t> divider;
+    type_t power;
+    uint_t digits;
+};
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// struct chunk_traits_t
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+template<typename native_t>
+struct chunk_traits_t {
+    native_t chunk_base = 1;
+    uint_t digits_per_chunk = 0;
+};
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// standalone helper methods
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+template<typename native_t>
+constexpr chunk_traits_t<native_t> get_chunk_traits(uint_t base) noexcept;
+constexpr uint_t char_to_digit(char ch) noexcept;
+template<typename native_t, uint_t size>
+constexpr void write_bit_fields(char* first, char* last, const long_uint_t<native_t, size>& value, uint_t digit_bits) noexcept;
+template<typename native_t>
+constexpr void write_decimal_chunk(char* first, char* last, native_t chunk) noexcept;
+constexpr uint64_t load_eight_chars(const char* ptr) noexcept;
+constexpr bool is_eight_decimal_digits(uint64_t chars) noexcept;
+constexpr bool is_eight_hex_digits(uint64_t chars) noexcept;
+constexpr uint32_t parse_eight_decimal_digits(uint64_t chars) noexcept;
+constexpr uint32_t parse_eight_hex_digits(uint64_t chars) noexcept;
+constexpr const char* scan_digits(const char* first, const char* last, uint_t base) noexcept;
+template<typename native_t, uint_t size>
+constexpr bool put_bit_field(long_uint_t<native_t, size>& value, uint_t position, native_t field, uint_t field_bits) noexcept;
+template<typename native_t, uint_t size>
+constexpr bool read_bit_fields(const char* first, const char* last, long_uint_t<native_t, size>& value, uint_t digit_bits) noexcept;
+template<typename native_t, uint_t size>
+constexpr bool read_chunks(const char* first, const char* last, long_uint_t<native_t, size>& value, uint_t base) noexcept;
+template<typename native_t, uint_t size>
+constexpr void write_decimal(char* first, char* last, const long_uint_t<native_t, size>& value) noexcept;
+template<typename type_t>
+constexpr auto make_decimal_split_table() noexcept;
+template<typename native_t, uint_t size>
+constexpr uint_t count_digits(const long_uint_t<native_t, size>& value, uint_t base) noexcept;
+template<typename native_t, uint_t size>
+constexpr native_t mul_add_chunk(long_uint_t<native_t, size>& value, native_t multiplier, native_t chunk) noexcept;
+template<typename native_t, uint_t size>
+constexpr native_t div_chunk(long_uint_t<native_t, size>& value, native_t divider) noexcept;
+
+} // namespace impl
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// standalone methods
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+template<typename native_t, uint_t size>
+constexpr std::to_chars_result to_chars(char* first, char* last, const long_uint_t<native_t, size>& value, int base) noexcept
+{
+    assert(base >= 2 && base <= 36);
+
+    const uint_t digit_size = impl::count_digits(value, static_cast<uint_t>(base));
+
+    if (last - first < static_cast<std::ptrdiff_t>(digit_size))
+        return { last, std::errc::value_too_large };
+
+    char* const digits_last = first + digit_size;
+
+    // digits of power of two bases are bit fields, that are read directly without division
+
+    if (std::has_single_bit(static_cast<uint_t>(base))) {
+
+        impl::write_bit_fields(first, digits_last, value, static_cast<uint_t>(std::countr_zero(static_cast<uint_t>(base))));
+        return { digits_last, std::errc() };
+    }
+
+    if (base == 10) {
+
+        impl::write_decimal(first, digits_last, value);
+        return { digits_last, std::errc() };
+    }
+
+    // split off base^k chunks with a single-word division and emit exactly digit_size digits backwards
+
+    const impl::chunk_traits_t<native_t> traits = impl::get_chunk_traits<native_t>(static_cast<uint_t>(base));
+    const native_t native_base = static_cast<native_t>(base);
+
+    long_uint_t<native_t, size> remainder = value;
+    char* digits_out = digits_last;
+
+    while (digits_out != first) {
+
+        native_t chunk = impl::div_chunk(remainder, traits.chunk_base);
+
+        for (uint_t n = 0; n < traits.digits_per_chunk && digits_out != first; ++n) {
+
+            *--digits_out = impl::digit_chars[static_cast<uint_t>(chunk % native_base)];
+            chunk /= native_base;
+        }
+    }
+
+    return { digits_last, std::errc() };
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+template<typename native_t, uint_t size>
+constexpr std::to_chars_result to_chars(char* first, char* last, const long_int_t<native_t, size>& value, int base) noexcept
+{
+    using long_uint_t = long_uint_t<native_t, size>;
+
+    if (!value.sign())
+        return to_chars(first, last, long_uint_t(value), base);
+
+    if (first == last)
+        return { last, std::errc::value_too_large };
+
+    // two's complement negation gives the right magnitude for the minimum value too
+
+    *first = '-';
+
+    return to_chars(first + 1, last, long_uint_t(-value), base);
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+template<typename native_t, uint_t size>
+constexpr std::from_chars_result from_chars(const char* first, const char* last, long_uint_t<native_t, size>& value, int base) noexcept
+{
+    assert(base >= 2 && base <= 36);
+
+    const uint_t uint_base = static_cast<uint_t>(base);
+    const char* const digits_last = impl::scan_digits(first, last, uint_base);
+
+    if (digits_last == first)
+        return { first, std::errc::invalid_argument };
+
+    // digits are already validated, so both readers only convert them
+
+    long_uint_t<native_t, size> result = 0;
+
+    const bool fits = std::has_single_bit(uint_base)
+        ? impl::read_bit_fields(first, digits_last, result, static_cast<uint_t>(std::countr_zero(uint_base)))
+        : impl::read_chunks(first, digits_last, result, uint_base);
+
+    if (!fits)
+        return { digits_last, std::errc::result_out_of_range };
+
+    value = result;
+
+    return { digits_last, std::errc() };
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+template<typename native_t, uint_t size>
+constexpr std::from_chars_result from_chars(const char* first, const char* last, long_int_t<native_t, size>& value, int base) noexcept
+{
+    using long_uint_t = long_uint_t<native_t, size>;
+    using long_int_t = long_int_t<native_t, size>;
+
+    const bool negative = first != last && *first == '-';
+    long_uint_t magnitude;
+    std::from_chars_result result = from_chars(first + uint_t(negative), last, magnitude, base);
+
+    if (result.ec == std::errc::invalid_argument)
+        return { first, std::errc::invalid_argument };
+
+    if (result.ec != std::errc())
+        return result;
+
+    // the negative range holds one more value than the positive one
+
+    constexpr long_uint_t uint_min_magnitude = long_uint_t(1) << (bit_count_v<long_int_t> - 1);
+    const long_uint_t limit = negative ? uint_min_magnitude : uint_min_magnitude - 1;
+
+    if (magnitude > limit)
+        return { result.ptr, std::errc::result_out_of_range };
+
+    value = long_int_t(negative ? -magnitude : magnitude);
+
+    return result;
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+template<typename type_t, std::enable_if_t<is_long_integer_v<type_t>, int>>
+constexpr parse_result_t<type_t> parse(std::string_view text) noexcept
+{
+    using unsigned_t = make_unsigned_t<type_t>;
+
+    constexpr uint_t max_digits = bit_count_v<type_t>;
+
+    size_t position = 0;
+    const bool negative = is_signed_v<type_t> && !text.empty() && text[0] == '-';
+
+    if (negative)
+        ++position;
+
+    // leading zero of octal number is its digit, so that separator may follow it
+
+    uint_t base = 10;
+
+    if (position < text.size() && text[position] == '0' && position + 1 < text.size()) {
+
+        const char prefix = text[position + 1];
+
+        if (prefix == 'x' || prefix == 'X') {
+
+            base = 16;
+            position += 2;
+
+        } else if (prefix == 'b' || prefix == 'B') {
+
+            base = 2;
+            position += 2;
+
+        } else
+            base = 8;
+    }
+
+    // the largest magnitude, that fits the type, decides where overflow starts
+
+    unsigned_t limit = ~unsigned_t(0U);
+
+    if constexpr (is_signed_v<type_t>)
+        limit = (limit >> 1) + unsigned_t(negative);
+
+    std::array<char, max_digits> limit_chars{};
+    const uint_t limit_size = static_cast<uint_t>(to_chars(limit_chars.data(), limit_chars.data() + limit_chars.size(), limit, static_cast<int>(base)).ptr - limit_chars.data());
+
+    // collect significant digits without separators, validating the whole text first
+
+    std::array<char, max_digits + 1> digits{};
+    uint_t digit_count = 0;
+    size_t last_fit_position = 0;
+    size_t overflow_position = 0;
+    bool after_digit = false;
+    bool has_digits = false;
+
+    for (; position < text.size(); ++position) {
+
+        const char ch = text[position];
+
+        if (ch == '\'') {
+
+            if (!after_digit || position + 1 == text.size() || impl::char_to_digit(text[position + 1]) >= base)
+                return { type_t(0U), std::errc::invalid_argument, position };
+
+            after_digit = false;
+            continue;
+        }
+
+        const uint_t digit = impl::char_to_digit(ch);
+
+        if (digit >= base)
+            return { type_t(0U), std::errc::invalid_argument, position };
+
+        after_digit = true;
+        has_digits = true;
+
+        if (digit == 0 && digit_count == 0)
+            continue;
+
+        if (digit_count + 1 == limit_size)
+            last_fit_position = position;
+        else if (digit_count == limit_size)
+            overflow_position = position;
+
+        if (digit_count < digits.size())
+            digits[digit_count] = impl::digit_chars[digit];
+
+        ++digit_count;
+    }
+
+    if (!has_digits)
+        return { type_t(0U), std::errc::invalid_argument, position };
+
+    // numbers with as many digits as the limit overflow at the last digit, if they are greater
+
+    if (digit_count >= limit_size) {
+
+        const std::string_view leading_digits(digits.data(), limit_size);
+        const std::string_view limit_digits(limit_chars.data(), limit_size);
+
+        if (leading_digits > limit_digits)
+            return { type_t(0U), std::errc::result_out_of_range, last_fit_position };
+
+        if (digit_count > limit_size)
+            return { type_t(0U), std::errc::result_out_of_range, overflow_position };
+    }
+
+    unsigned_t magnitude = 0U;
+
+    if (digit_count != 0)
+        from_chars(digits.data(), digits.data() + digit_count, magnitude, static_cast<int>(base));
+
+    return { negative ? type_t(-magnitude) : type_t(magnitude), std::errc(), text.size() };
+}
+
+namespace impl
+{
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// standalone helper methods
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+template<typename native_t>
+constexpr chunk_traits_t<native_t> get_chunk_traits(uint_t base) noexcept
+{
+    constexpr native_t max_value = std::numeric_limits<native_t>::max();
+    chunk_traits_t<native_t> result;
+
+    // choose the largest base^k that still fits into a native word
+
+    while (result.chunk_base <= max_value / static_cast<native_t>(base)) {
+
+        result.chunk_base *= static_cast<native_t>(base);
+        ++result.digits_per_chunk;
+    }
+
+    return result;
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+constexpr uint_t char_to_digit(char ch) noexcept
+{
+    if (ch >= '0' && ch <= '9')
+        return static_cast<uint_t>(ch - '0');
+
+    if (ch >= 'a' && ch <= 'z')
+        return static_cast<uint_t>(ch - 'a' + 10);
+
+    if (ch >= 'A' && ch <= 'Z')
+        return static_cast<uint_t>(ch - 'A' + 10);
+
+    return std::numeric_limits<uint_t>::max();
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+template<typename native_t, uint_t size>
+constexpr void write_bit_fields(char* first, char* last, const long_uint_t<native_t, size>& value, uint_t digit_bits) noexcept
+{
+    constexpr uint_t native_bits = bit_count_v<native_t>;
+
+    const native_t mask = static_cast<native_t>((1U << digit_bits) - 1);
+
+    native_t field = value.digits[0];
+    uint_t field_bits = native_bits;
+    uint_t index = 0;
+
+    // emit digits backwards from the least significant bits, a digit may span two native digits
+
+    while (last != first) {
+
+        if (field_bits >= digit_bits) {
+
+            *--last = digit_chars[static_cast<uint_t>(field & mask)];
+            field = static_cast<native_t>(field >> digit_bits);
+            field_bits -= digit_bits;
+
+        } else {
+
+            const native_t next = ++index < size ? value.digits[index] : native_t(0);
+            const uint_t next_bits = digit_bits - field_bits;
+
+            *--last = digit_chars[static_cast<uint_t>(static_cast<native_t>(field | static_cast<native_t>(next << field_bits)) & mask)];
+            field = static_cast<native_t>(next >> next_bits);
+            field_bits = native_bits - next_bits;
+        }
+    }
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+template<typename type_t>
+constexpr auto make_decimal_split_table() noexcept
+{
+    using native_t = typename type_t::native_array_t::value_type;
+
+    constexpr uint_t chunk_digits = get_chunk_traits<native_t>(10).digits_per_chunk;
+    constexpr uint_t max_digits = std::numeric_limits<type_t>::digits10;
+    constexpr uint_t table_size = std::bit_width(max_digits / chunk_digits);
+
+    // 10^k fits into a native digit, every next power is squared while it fits into type_t
+
+    std::array<decimal_split_t<type_t>, table_size> table;
+    type_t power = get_chunk_traits<native_t>(10).chunk_base;
+
+    for (uint_t level = 0; level < table_size; ++level) {
+
+        table[level] = { long_fixed_divider<type_t>(power), power, chunk_digits << level };
+        power *= power;
+    }
+
+    return table;
+}
+
+template<typename type_t>
+constexpr auto decimal_split_table = make_decimal_split_table<type_t>();
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+template<typename native_t>
+constexpr void write_decimal_chunk(char* first, char* last, native_t chunk) noexcept
+{
+    // emit two digits per division, leading zeros fill the whole range
+
+    while (last - first >= 2) {
+
+        const uint_t pair = static_cast<uint_t>(chunk % 100) * 2;
+        chunk = static_cast<native_t>(chunk / 100);
+
+        *--last = digit_pairs[pair + 1];
+        *--last = digit_pairs[pair];
+    }
+
+    if (last != first)
+        *--last = digit_chars[static_cast<uint_t>(chunk % 10)];
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+template<typename native_t, uint_t size>
+constexpr void write_decimal(char* first, char* last, const long_uint_t<native_t, size>& value) noexcept
+{
+    using long_uint_t = long_uint_t<native_t, size>;
+
+    constexpr auto& split_table = decimal_split_table<long_uint_t>;
+    const uint_t digit_count = static_cast<uint_t>(last - first);
+
+    if (digit_count <= split_table[0].digits) {
+
+        write_decimal_chunk(first, last, static_cast<native_t>(value));
+        return;
+    }
+
+    // continue with narrower integers as soon as the value fits, so splits need fewer digits multiplied
+
+    if constexpr (size > 2) {
+
+        using half_uint_t = slim::long_uint_t<native_t, size / 2>;
+
+        if (digit_count <= std::numeric_limits<half_uint_t>::digits10) {
+
+            write_decimal(first, last, static_cast<half_uint_t>(value));
+            return;
+        }
+    }
+
+    // split off the largest 10^(k * 2^n) below the digit count, lower part is padded with zeros
+
+    uint_t level = 0;
+
+    while (level + 1 < split_table.size() && split_table[level + 1].digits < digit_count)
+        ++level;
+
+    const decimal_split_t<long_uint_t>& split = split_table[level];
+    const long_uint_t value_hi = value / split.divider;
+    const long_uint_t value_lo = value - value_hi * split.power;
+
+    write_decimal(last - split.digits, last, value_lo);
+    write_decimal(first, last - split.digits, value_hi);
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+constexpr uint64_t load_eight_chars(const char* ptr) noexcept
+{
+    // little-endian assembly is folded into a single load by compilers
+
+    uint64_t result = 0;
+
+    for (uint_t n = 0; n < 8; ++n)
+        result |= static_cast<uint64_t>(static_cast<uint8_t>(ptr[n])) << (n * 8);
+
+    return result;
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+constexpr bool is_eight_decimal_digits(uint64_t chars) noexcept
+{
+    // every byte has 0x3 in the upper half and does not pass 0xf when 6 is added
+
+    return ((chars & 0xf0f0f0f0f0f0f0f0) | (((chars + 0x0606060606060606) & 0xf0f0f0f0f0f0f0f0) >> 4)) == 0x3333333333333333;
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+constexpr bool is_eight_hex_digits(uint64_t chars) noexcept
+{
+    constexpr uint64_t ones = 0x0101010101010101;
+    constexpr uint64_t high_bits = ones * 0x80;
+
+    if ((chars & high_bits) != 0)
+        return false;
+
+    // bytes below 0x80 do not carry, so the high bit of x + (0x80 - lo) is set for x >= lo and of
+    // x + (0x7f - hi) for x > hi
+
+    const auto in_range = [](uint64_t bytes, uint64_t lo, uint64_t hi) {
+        return (bytes + ones * (0x80 - lo)) & ~(bytes + ones * (0x7f - hi)) & high_bits;
+    };
+
+    return (in_range(chars, '0', '9') | in_range(chars | ones * 0x20, 'a', 'f')) == high_bits;
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+constexpr uint32_t parse_eight_decimal_digits(uint64_t chars) noexcept
+{
+    // combine digit pairs, then pairs of pairs with two multiplications
+
+    chars -= 0x3030303030303030;
+    chars = chars * 10 + (chars >> 8);
+    chars = ((chars & 0x000000ff000000ff) * 0x000f424000000064 + ((chars >> 16) & 0x000000ff000000ff) * 0x0000271000000001) >> 32;
+
+    return static_cast<uint32_t>(chars);
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+constexpr uint32_t parse_eight_hex_digits(uint64_t chars) noexcept
+{
+    // low nibble of letters is one for 'a' and 'A', so nine is added to letters only
+
+    const uint64_t letters = (chars >> 6) & 0x0101010101010101;
+    uint64_t nibbles = (chars & 0x0f0f0f0f0f0f0f0f) + letters * 9;
+
+    // the first character is the lowest byte and the most significant digit
+
+    nibbles = ((nibbles & 0x000f000f000f000f) << 4) | ((nibbles >> 8) & 0x000f000f000f000f);
+    nibbles = ((nibbles & 0x000000ff000000ff) << 8) | ((nibbles >> 16) & 0x000000ff000000ff);
+    nibbles = ((nibbles & 0x000000000000ffff) << 16) | ((nibbles >> 32) & 0x000000000000ffff);
+
+    return static_cast<uint32_t>(nibbles);
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+constexpr const char* scan_digits(const char* first, const char* last, uint_t base) noexcept
+{
+    if (base == 10) {
+
+        while (last - first >= 8 && is_eight_decimal_digits(load_eight_chars(first)))
+            first += 8;
+
+    } else if (base == 16) {
+
+        while (last - first >= 8 && is_eight_hex_digits(load_eight_chars(first)))
+            first += 8;
+    }
+
+    while (first != last && char_to_digit(*first) < base)
+        ++first;
+
+    return first;
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+template<typename native_t, uint_t size>
+constexpr bool put_bit_field(long_uint_t<native_t, size>& value, uint_t position, native_t field, uint_t field_bits) noexcept
+{
+    constexpr uint_t native_bits = bit_count_v<native_t>;
+
+    const uint_t index = position / native_bits;
+    const uint_t offset = position % native_bits;
+
+    // bits above the most significant digit are allowed to be zeros only
+
+    if (index >= size)
+        return field == 0;
+
+    value.digits[index] |= static_cast<native_t>(field << offset);
+
+    if (offset == 0 || offset + field_bits <= native_bits)
+        return true;
+
+    const native_t spill = static_cast<native_t>(field >> (native_bits - offset));
+
+    if (index + 1 >= size)
+        return spill == 0;
+
+    value.digits[index + 1] |= spill;
+
+    return true;
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+template<typename native_t, uint_t size>
+constexpr bool read_bit_fields(const char* first, const char* last, long_uint_t<native_t, size>& value, uint_t digit_bits) noexcept
+{
+    uint_t position = 0;
+    bool fits = true;
+
+    // place digits from the least significant one, eight hex digits fill 32 aligned bits at once
+
+    if constexpr (bit_count_v<native_t> >= 32) {
+
+        if (digit_bits == 4) {
+
+            for (; last - first >= 8; position += 32) {
+
+                last -= 8;
+                fits &= put_bit_field(value, position, static_cast<native_t>(parse_eight_hex_digits(load_eight_chars(last))), 32);
+            }
+        }
+    }
+
+    for (; last != first; position += digit_bits)
+        fits &= put_bit_field(value, position, static_cast<native_t>(char_to_digit(*--last)), digit_bits);
+
+    return fits;
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+template<typename native_t, uint_t size>
+constexpr bool read_chunks(const char* first, const char* last, long_uint_t<native_t, size>& value, uint_t base) noexcept
+{
+    const chunk_traits_t<native_t> traits = get_chunk_traits<native_t>(base);
+    const native_t native_base = static_cast<native_t>(base);
+
+    // accumulate up to digits_per_chunk digits in a native word and fold it into the wide value
+
+    while (first != last) {
+
+        const uint_t chunk_size = std::min<uint_t>(traits.digits_per_chunk, static_cast<uint_t>(last - first));
+        native_t chunk = 0;
+        native_t multiplier = 1;
+        uint_t n = 0;
+
+        if constexpr (bit_count_v<native_t> >= 32) {
+
+            constexpr native_t eight_digit_scale = 100000000;
+
+            for (; base == 10 && n + 8 <= chunk_size; n += 8, first += 8) {
+
+                chunk = chunk * eight_digit_scale + static_cast<native_t>(parse_eight_decimal_digits(load_eight_chars(first)));
+                multiplier *= eight_digit_scale;
+            }
+        }
+
+        for (; n < chunk_size; ++n, ++first) {
+
+            chunk = chunk * native_base + static_cast<native_t>(char_to_digit(*first));
+            multiplier *= native_base;
+        }
+
+        if (mul_add_chunk(value, multiplier, chunk) != 0)
+            return false;
+    }
+
+    return true;
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+template<typename native_t, uint_t size>
+constexpr uint_t count_digits(const long_uint_t<native_t, size>& value, uint_t base) noexcept
+{
+    // power of two bases take a fixed number of bits per digit
+
+    if (std::has_single_bit(base)) {
+
+        const uint_t bit_length = bit_count_v<long_uint_t<native_t, size>> - nlz(value);
+        const uint_t digit_bits = static_cast<uint_t>(std::countr_zero(base));
+
+        return std::max<uint_t>(1, (bit_length + digit_bits - 1) / digit_bits);
+    }
+
+    if (base == 10)
+        return decimal_digits(value);
+
+    // other bases count whole chunks first
+
+    const chunk_traits_t<native_t> traits = get_chunk_traits<native_t>(base);
+
+    long_uint_t<native_t, size> remainder = value;
+    uint_t result = 1;
+
+    while (remainder >= traits.chunk_base) {
+
+        div_chunk(remainder, traits.chunk_base);
+        result += traits.digits_per_chunk;
+    }
+
+    for (native_t top = static_cast<native_t>(remainder); top >= static_cast<native_t>(base); top /= static_cast<native_t>(base))
+        ++result;
+
+    return result;
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+template<typename native_t, uint_t size>
+constexpr native_t mul_add_chunk(long_uint_t<native_t, size>& value, native_t multiplier, native_t chunk) noexcept
+{
+    native_t carry = chunk;
+
+    for (uint_t n = 0; n < size; ++n)
+        carry = mulc(value.digits[n], multiplier, carry);
+
+    return carry;
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+template<typename native_t, uint_t size>
+constexpr native_t div_chunk(long_uint_t<native_t, size>& value, native_t divider) noexcept
+{
+    native_t remainder = 0;
+
+    for (uint_t n = size; n-- > 0;)
+        value.digits[n] = divqr2(remainder, value.digits[n], divider, remainder);
+
+    return remainder;
+}
+
+} // namespace impl
+} // namespace slim
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// End of long_charconv.h
+////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,302 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// Simple Long Integer Math for C++
+// version 2.0
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// Licensed under the MIT License <http://opensource.org/licenses/MIT>.
+// SPDX-License-Identifier: MIT
+//
+// Copyright (c) 2020-2026 Yury Kalmykov <y_kalmykov@mail.ru>.
+//
+// Permission is hereby  granted, free of charge, to any  person obtaining a copy
+// of this software and associated  documentation files (the "Software"), to deal
+// in the Software  without restriction, including without  limitation the rights
+// to  use, copy,  modify, merge,  publish, distribute,  sublicense, and/or  sell
+// copies  of  the Software,  and  to  permit persons  to  whom  the Software  is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE  IS PROVIDED "AS  IS", WITHOUT WARRANTY  OF ANY KIND,  EXPRESS OR
+// IMPLIED,  INCLUDING BUT  NOT  LIMITED TO  THE  WARRANTIES OF  MERCHANTABILITY,
+// FITNESS FOR  A PARTICULAR PURPOSE AND  NONINFRINGEMENT. IN NO EVENT  SHALL THE
+// AUTHORS  OR COPYRIGHT  HOLDERS  BE  LIABLE FOR  ANY  CLAIM,  DAMAGES OR  OTHER
+// LIABILITY, WHETHER IN AN ACTION OF  CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE  OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+
+#pragma once
+
+#include "long_math.h"
+
+#include <cstdlib>
+#include <optional>
+#include <string_view>
+
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+#include <cpuid.h>
+#elif defined(_MSC_VER) && (defined(_M_IX86) || defined(_M_X64))
+#include <intrin.h>
+#endif
+
+namespace slim
+{
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// cpu_features_t structure
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+// instruction set extensions of the running processor, vector extensions are reported only if the
+// operating system saves the corresponding registers
+
+struct cpu_features_t
+{
+    bool bmi2 = false;
+    bool adx = false;
+    bool avx2 = false;
+    bool avx512f = false;
+    bool avx512bw = false;
+    bool avx512vl = false;
+    bool avx512ifma = false;
+};
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// isa_t enumeration
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+// instruction set levels of run-time kernel selection, every level includes the previous ones:
+// avx2 requires AVX2, avx512 and avx512ifma the F subset; BMI2 and ADX are checked separately by
+// the kernels which use mulx
+
+enum class isa_t
+{
+    baseline,
+    avx2,
+    avx512,
+    avx512ifma,
+};
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// standalone methods
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+// features are detected once on first call, the call is thread-safe
+
+const cpu_features_t& cpu_features() noexcept;
+
+// highest level supported by the processor and level used by kernel selection, the latter may be
+// lowered by SLIMCPP_ISA environment variable set to baseline, avx2, avx512 or avx512ifma, so that
+// every kernel can be benchmarked on the same machine; levels above detected one are ignored
+
+isa_t detected_isa() noexcept;
+isa_t isa() noexcept;
+constexpr std::string_view isa_name(isa_t level) noexcept;
+constexpr std::optional<isa_t> parse_isa(std::string_view name) noexcept;
+
+namespace impl
+{
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// standalone helper methods
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+cpu_features_t detect_cpu_features() noexcept;
+isa_t select_isa() noexcept;
+std::array<uint32_t, 4> cpuid(uint32_t leaf, uint32_t subleaf) noexcept;
+uint64_t xgetbv() noexcept;
+
+} // namespace impl
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// standalone methods
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+inline const cpu_features_t& cpu_features() noexcept
+{
+    static const cpu_features_t features = impl::detect_cpu_features();
+
+    return features;
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+inline isa_t detected_isa() noexcept
+{
+    const cpu_features_t& features = cpu_features();
+
+    if (!features.avx2)
+        return isa_t::baseline;
+    else if (!features.avx512f)
+        return isa_t::avx2;
+    else if (!features.avx512ifma)
+        return isa_t::avx512;
+    else
+        return isa_t::avx512ifma;
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+inline isa_t isa() noexcept
+{
+    static const isa_t level = impl::select_isa();
+
+    return level;
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+constexpr std::string_view isa_name(isa_t level) noexcept
+{
+    switch (level) {
+    case isa_t::avx2:
+        return "avx2";
+    case isa_t::avx512:
+        return "avx512";
+    case isa_t::avx512ifma:
+        return "avx512ifma";
+    default:
+        return "baseline";
+    }
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+constexpr std::optional<isa_t> parse_isa(std::string_view name) noexcept
+{
+    for (isa_t level : {isa_t::baseline, isa_t::avx2, isa_t::avx512, isa_t::avx512ifma}) {
+
+        if (name == isa_name(level))
+            return level;
+    }
+
+    return std::nullopt;
+}
+
+
+
+namespace impl
+{
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// standalone helper methods
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+inline cpu_features_t detect_cpu_features() noexcept
+{
+    cpu_features_t features;
+
+    const uint32_t max_leaf = cpuid(0, 0)[0];
+
+    if (max_leaf < 7)
+        return features;
+
+    const std::array<uint32_t, 4> leaf1 = cpuid(1, 0);
+    const std::array<uint32_t, 4> leaf7 = cpuid(7, 0);
+
+    const auto has_bit = [](uint32_t reg, uint_t bit) { return (reg & (uint32_t(1) << bit)) != 0; };
+
+    features.bmi2 = has_bit(leaf7[1], 8);
+    features.adx = has_bit(leaf7[1], 19);
+
+    // vector registers must be enabled by the operating system: XMM and YMM state for AVX,
+    // opmask and upper ZMM state for AVX-512
+
+    if (!has_bit(leaf1[2], 27) || !has_bit(leaf1[2], 28))
+        return features;
+
+    const uint64_t xcr0 = xgetbv();
+    const bool avx_state = (xcr0 & 0x06) == 0x06;
+    const bool avx512_state = (xcr0 & 0xe6) == 0xe6;
+
+    features.avx2 = avx_state && has_bit(leaf7[1], 5);
+    features.avx512f = avx512_state && has_bit(leaf7[1], 16);
+    features.avx512bw = features.avx512f && has_bit(leaf7[1], 30);
+    features.avx512vl = features.avx512f && has_bit(leaf7[1], 31);
+    features.avx512ifma = features.avx512f && has_bit(leaf7[1], 21);
+
+    return features;
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+inline isa_t select_isa() noexcept
+{
+    const isa_t detected = detected_isa();
+
+#ifdef _MSC_VER
+#pragma warning(suppress : 4996)
+#endif
+    const char* name = std::getenv("SLIMCPP_ISA");
+
+    if (name == nullptr)
+        return detected;
+
+    // unknown names are ignored, the override can't enable unsupported instructions
+
+    const std::optional<isa_t> requested = parse_isa(name);
+
+    return requested && *requested < detected ? *requested : detected;
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+inline std::array<uint32_t, 4> cpuid(uint32_t leaf, uint32_t subleaf) noexcept
+{
+    std::array<uint32_t, 4> regs = {};
+
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+    __cpuid_count(leaf, subleaf, regs[0], regs[1], regs[2], regs[3]);
+#elif defined(_MSC_VER) && (defined(_M_IX86) || defined(_M_X64))
+    int info[4];
+    __cpuidex(info, static_cast<int>(leaf), static_cast<int>(subleaf));
+
+    for (uint_t n = 0; n < std::size(regs); ++n)
+        regs[n] = static_cast<uint32_t>(info[n]);
+#else
+    static_cast<void>(leaf);
+    static_cast<void>(subleaf);
+#endif
+
+    return regs;
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+inline uint64_t xgetbv() noexcept
+{
+    // read extended control register 0, callers check OSXSAVE before
+
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+    uint32_t lo;
+    uint32_t hi;
+    __asm__("xgetbv" : "=a"(lo), "=d"(hi) : "c"(0));
+
+    return (uint64_t(hi) << 32) | lo;
+#elif defined(_MSC_VER) && (defined(_M_IX86) || defined(_M_X64))
+    return _xgetbv(0);
+#else
+    return 0;
+#endif
+}
+
+} // namespace impl
+} // namespace slim
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// End of long_cpu.h
+////////////////////////////////////////////////////////////////////////////////////////////////////
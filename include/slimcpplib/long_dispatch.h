@@ -0,0 +1,239 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// Simple Long Integer Math for C++
+// version 2.0
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// Licensed under the MIT License <http://opensource.org/licenses/MIT>.
+// SPDX-License-Identifier: MIT
+//
+// Copyright (c) 2020-2026 Yury Kalmykov <y_kalmykov@mail.ru>.
+//
+// Permission is hereby  granted, free of charge, to any  person obtaining a copy
+// of this software and associated  documentation files (the "Software"), to deal
+// in the Software  without restriction, including without  limitation the rights
+// to  use, copy,  modify, merge,  publish, distribute,  sublicense, and/or  sell
+// copies  of  the Software,  and  to  permit persons  to  whom  the Software  is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE  IS PROVIDED "AS  IS", WITHOUT WARRANTY  OF ANY KIND,  EXPRESS OR
+// IMPLIED,  INCLUDING BUT  NOT  LIMITED TO  THE  WARRANTIES OF  MERCHANTABILITY,
+// FITNESS FOR  A PARTICULAR PURPOSE AND  NONINFRINGEMENT. IN NO EVENT  SHALL THE
+// AUTHORS  OR COPYRIGHT  HOLDERS  BE  LIABLE FOR  ANY  CLAIM,  DAMAGES OR  OTHER
+// LIABILITY, WHETHER IN AN ACTION OF  CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE  OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+
+#pragma once
+
+#include "long_charconv.h"
+#include "long_cpu.h"
+#include "long_simd.h"
+
+#include <charconv>
+
+namespace slim
+{
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// dispatch_table_t structure
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+// run-time entry points of hot kernels bound for one instruction set level: array kernels are the
+// ones of long_simd.h, scalar kernels are operators and to_chars() or their versions compiled for
+// the level with function target attributes; constexpr evaluation always uses operators directly
+
+template<typename type_t>
+struct dispatch_table_t
+{
+    using binary_t = type_t (*)(const type_t& value1, const type_t& value2) noexcept;
+    using to_chars_t = std::to_chars_result (*)(char* first, char* last, const type_t& value, int base) noexcept;
+
+    isa_t level = isa_t::baseline;
+    binary_t mul = nullptr;
+    binary_t div = nullptr;
+    binary_t mod = nullptr;
+    array_kernel_t<type_t> add_n = nullptr;
+    array_kernel_t<type_t> sub_n = nullptr;
+    array_kernel_t<type_t> mul_n = nullptr;
+    to_chars_t to_chars = nullptr;
+};
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// standalone methods
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+// table for the level returned by isa() is bound once per type on first call, tables for other
+// levels are made on request, levels above detected_isa() are lowered to it
+
+template<typename type_t, std::enable_if_t<is_long_integer_v<type_t>, int> = 0>
+const dispatch_table_t<type_t>& dispatch_table() noexcept;
+template<typename type_t, std::enable_if_t<is_long_integer_v<type_t>, int> = 0>
+dispatch_table_t<type_t> make_dispatch_table(isa_t level) noexcept;
+
+namespace impl
+{
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// standalone helper methods
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+template<typename type_t>
+type_t mul_baseline(const type_t& value1, const type_t& value2) noexcept;
+template<typename type_t>
+type_t div_baseline(const type_t& value1, const type_t& value2) noexcept;
+template<typename type_t>
+type_t mod_baseline(const type_t& value1, const type_t& value2) noexcept;
+template<typename type_t>
+std::to_chars_result to_chars_baseline(char* first, char* last, const type_t& value, int base) noexcept;
+
+#if defined(__GNUC__) && defined(__x86_64__)
+
+// bound on the avx2 level only when BMI2 and ADX are present too, so that compiler uses mulx
+
+template<typename type_t>
+__attribute__((target("avx2,bmi2,adx"))) type_t mul_avx2(const type_t& value1, const type_t& value2) noexcept;
+
+#endif // defined(__GNUC__) && defined(__x86_64__)
+
+} // namespace impl
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// standalone methods
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+template<typename type_t, std::enable_if_t<is_long_integer_v<type_t>, int>>
+inline const dispatch_table_t<type_t>& dispatch_table() noexcept
+{
+    static const dispatch_table_t<type_t> table = make_dispatch_table<type_t>(isa());
+
+    return table;
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+template<typename type_t, std::enable_if_t<is_long_integer_v<type_t>, int>>
+inline dispatch_table_t<type_t> make_dispatch_table(isa_t level) noexcept
+{
+    dispatch_table_t<type_t> table;
+
+    table.level = std::min(level, detected_isa());
+    table.mul = impl::mul_baseline<type_t>;
+    table.div = impl::div_baseline<type_t>;
+    table.mod = impl::mod_baseline<type_t>;
+    table.add_n = impl::add_n_kernel<type_t>(table.level);
+    table.sub_n = impl::sub_n_kernel<type_t>(table.level);
+    table.mul_n = impl::mul_n_kernel<type_t>(table.level);
+    table.to_chars = impl::to_chars_baseline<type_t>;
+
+#if defined(__GNUC__) && defined(__x86_64__)
+    // scalar kernels gain nothing from AVX-512, so that higher levels use the avx2 ones; division
+    // and formatting are bound to baseline kernels on every level, their versions compiled for BMI2
+    // and LZCNT aren't faster; mulx and adcx need BMI2 and ADX on top of the level
+
+    if (table.level >= isa_t::avx2 && cpu_features().bmi2 && cpu_features().adx)
+        table.mul = impl::mul_avx2<type_t>;
+#endif // defined(__GNUC__) && defined(__x86_64__)
+
+    return table;
+}
+
+
+
+namespace impl
+{
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// standalone helper methods
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+template<typename type_t>
+inline type_t mul_baseline(const type_t& value1, const type_t& value2) noexcept
+{
+    return value1 * value2;
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+template<typename type_t>
+inline type_t div_baseline(const type_t& value1, const type_t& value2) noexcept
+{
+    return value1 / value2;
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+template<typename type_t>
+inline type_t mod_baseline(const type_t& value1, const type_t& value2) noexcept
+{
+    return value1 % value2;
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+template<typename type_t>
+inline std::to_chars_result to_chars_baseline(char* first, char* last, const type_t& value, int base) noexcept
+{
+    return slim::to_chars(first, last, value, base);
+}
+
+
+
+#if defined(__GNUC__) && defined(__x86_64__)
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+template<typename type_t>
+__attribute__((target("avx2,bmi2,adx"))) inline type_t mul_avx2(const type_t& value1, const type_t& value2) noexcept
+{
+    using native_array_t = typename type_t::native_array_t;
+
+    if constexpr (std::is_same_v<typename native_array_t::value_type, uint64_t>) {
+
+        // only the low half of the product is computed, row by row of mulx products, carry of every
+        // row is kept in a single word, so that there is no carry propagation into upper digits
+
+        constexpr uint_t size = std::tuple_size_v<native_array_t>;
+
+        const native_array_t& digits1 = value1.digits;
+        const native_array_t& digits2 = value2.digits;
+        native_array_t result = {};
+
+        for (uint_t j = 0; j < size; ++j) {
+
+            uint64_t carry = 0;
+
+            for (uint_t i = 0; i + j < size - 1; ++i) {
+
+                const unsigned __int128 product = static_cast<unsigned __int128>(digits1[i]) * digits2[j] + result[i + j] + carry;
+
+                result[i + j] = static_cast<uint64_t>(product);
+                carry = static_cast<uint64_t>(product >> 64);
+            }
+
+            result[size - 1] += digits1[size - 1 - j] * digits2[j] + carry;
+        }
+
+        return type_t(result);
+    } else
+        return value1 * value2;
+}
+
+#endif // defined(__GNUC__) && defined(__x86_64__)
+
+} // namespace impl
+} // namespace slim
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// End of long_dispatch.h
+////////////////////////////////////////////////////////////////////////////////////////////////////
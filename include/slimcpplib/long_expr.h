@@ -0,0 +1,443 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// Simple Long Integer Math for C++
+// version 2.0
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// Licensed under the MIT License <http://opensource.org/licenses/MIT>.
+// SPDX-License-Identifier: MIT
+//
+// Copyright (c) 2020-2026 Yury Kalmykov <y_kalmykov@mail.ru>.
+//
+// Permission is hereby  granted, free of charge, to any  person obtaining a copy
+// of this software and associated  documentation files (the "Software"), to deal
+// in the Software  without restriction, including without  limitation the rights
+// to  use, copy,  modify, merge,  publish, distribute,  sublicense, and/or  sell
+// copies  of  the Software,  and  to  permit persons  to  whom  the Software  is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE  IS PROVIDED "AS  IS", WITHOUT WARRANTY  OF ANY KIND,  EXPRESS OR
+// IMPLIED,  INCLUDING BUT  NOT  LIMITED TO  THE  WARRANTIES OF  MERCHANTABILITY,
+// FITNESS FOR  A PARTICULAR PURPOSE AND  NONINFRINGEMENT. IN NO EVENT  SHALL THE
+// AUTHORS  OR COPYRIGHT  HOLDERS  BE  LIABLE FOR  ANY  CLAIM,  DAMAGES OR  OTHER
+// LIABILITY, WHETHER IN AN ACTION OF  CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE  OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include "long_int.h"
+#include "long_uint.h"
+
+namespace slim
+{
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// standalone methods
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+// calculate (value * multiplier + addend) computing only the lower digits of product
+
+template<typename type_t, std::enable_if_t<is_long_integer_v<type_t>, int> = 0>
+constexpr type_t muladd(const type_t& value, const type_t& multiplier, const type_t& addend) noexcept;
+
+// calculate ((value1 + value2) >> shift) keeping the carry of addition as the next higher bit
+
+template<typename type_t, std::enable_if_t<is_long_integer_v<type_t> && is_unsigned_v<type_t>, int> = 0>
+constexpr type_t addshr(const type_t& value1, const type_t& value2, uint_t shift) noexcept;
+
+namespace expr
+{
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// operation tags
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+struct add_op {};
+struct sub_op {};
+struct mul_op {};
+struct div_op {};
+struct mod_op {};
+struct shl_op {};
+struct shr_op {};
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// term class
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+template<typename type_t>
+struct term
+{
+    using value_type = type_t;
+
+    constexpr value_type eval() const noexcept;
+    constexpr operator value_type() const noexcept;
+
+    value_type value;
+};
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// binary class
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+template<typename op_t, typename left_t, typename right_t>
+struct binary
+{
+    using value_type = typename left_t::value_type;
+
+    static_assert(std::is_same_v<value_type, typename right_t::value_type>, "expression operands must have the same type.");
+
+    constexpr value_type eval() const noexcept;
+    constexpr operator value_type() const noexcept;
+
+    left_t left;
+    right_t right;
+};
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// shift class
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+template<typename op_t, typename expr_t>
+struct shift
+{
+    using value_type = typename expr_t::value_type;
+
+    constexpr value_type eval() const noexcept;
+    constexpr operator value_type() const noexcept;
+
+    expr_t expr;
+    uint_t count;
+};
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// type traits
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+template<typename type_t>
+constexpr bool is_expression_v = false;
+template<typename type_t>
+constexpr bool is_expression_v<term<type_t>> = true;
+template<typename op_t, typename left_t, typename right_t>
+constexpr bool is_expression_v<binary<op_t, left_t, right_t>> = true;
+template<typename op_t, typename expr_t>
+constexpr bool is_expression_v<shift<op_t, expr_t>> = true;
+
+template<typename op_t, typename type_t>
+constexpr bool is_binary_v = false;
+template<typename op_t, typename left_t, typename right_t>
+constexpr bool is_binary_v<op_t, binary<op_t, left_t, right_t>> = true;
+
+template<typename left_t, typename right_t>
+constexpr bool is_operands_v = (is_expression_v<left_t> || is_expression_v<right_t>) &&
+    (is_expression_v<left_t> || is_integer_v<left_t>) && (is_expression_v<right_t> || is_integer_v<right_t>);
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// standalone methods
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+// capture long integer value as expression term
+
+template<typename type_t, std::enable_if_t<is_long_integer_v<type_t>, int> = 0>
+constexpr term<type_t> lazy(const type_t& value) noexcept;
+
+// evaluate expression
+
+template<typename expr_t, std::enable_if_t<is_expression_v<expr_t>, int> = 0>
+constexpr typename expr_t::value_type eval(const expr_t& expr) noexcept;
+
+// expression operators
+
+template<typename left_t, typename right_t, std::enable_if_t<is_operands_v<left_t, right_t>, int> = 0>
+constexpr auto operator+(const left_t& left, const right_t& right) noexcept;
+template<typename left_t, typename right_t, std::enable_if_t<is_operands_v<left_t, right_t>, int> = 0>
+constexpr auto operator-(const left_t& left, const right_t& right) noexcept;
+template<typename left_t, typename right_t, std::enable_if_t<is_operands_v<left_t, right_t>, int> = 0>
+constexpr auto operator*(const left_t& left, const right_t& right) noexcept;
+template<typename left_t, typename right_t, std::enable_if_t<is_operands_v<left_t, right_t>, int> = 0>
+constexpr auto operator/(const left_t& left, const right_t& right) noexcept;
+template<typename left_t, typename right_t, std::enable_if_t<is_operands_v<left_t, right_t>, int> = 0>
+constexpr auto operator%(const left_t& left, const right_t& right) noexcept;
+template<typename expr_t, std::enable_if_t<is_expression_v<expr_t>, int> = 0>
+constexpr shift<shl_op, expr_t> operator<<(const expr_t& expr, uint_t count) noexcept;
+template<typename expr_t, std::enable_if_t<is_expression_v<expr_t>, int> = 0>
+constexpr shift<shr_op, expr_t> operator>>(const expr_t& expr, uint_t count) noexcept;
+
+} // namespace expr
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// standalone methods
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+template<typename type_t, std::enable_if_t<is_long_integer_v<type_t>, int>>
+constexpr type_t muladd(const type_t& value, const type_t& multiplier, const type_t& addend) noexcept
+{
+    type_t result = value;
+
+    mul_add(result.digits, multiplier.digits, addend.digits);
+
+    return result;
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+template<typename type_t, std::enable_if_t<is_long_integer_v<type_t> && is_unsigned_v<type_t>, int>>
+constexpr type_t addshr(const type_t& value1, const type_t& value2, uint_t shift) noexcept
+{
+    type_t result = value1;
+    const bool carry = add(result.digits, value2.digits);
+
+    // shift the sum as (bit_count + 1)-bit value
+
+    if (shift == 0)
+        return result;
+    if (shift >= bit_count_v<type_t>)
+        return type_t(shift == bit_count_v<type_t> && carry);
+
+    result >>= shift;
+
+    if (carry)
+        result |= type_t(1) << (bit_count_v<type_t> - shift);
+
+    return result;
+}
+
+namespace expr
+{
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// term class
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+template<typename type_t>
+constexpr typename term<type_t>::value_type term<type_t>::eval() const noexcept
+{
+    return value;
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+template<typename type_t>
+constexpr term<type_t>::operator value_type() const noexcept
+{
+    return eval();
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// binary class
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+template<typename op_t, typename left_t, typename right_t>
+constexpr typename binary<op_t, left_t, right_t>::value_type binary<op_t, left_t, right_t>::eval() const noexcept
+{
+    // fused kernels for known patterns
+
+    if constexpr (std::is_same_v<op_t, div_op> && is_binary_v<mul_op, left_t>)
+        return muldiv(left.left.eval(), left.right.eval(), right.eval());
+    else if constexpr (std::is_same_v<op_t, add_op> && is_binary_v<mul_op, left_t>)
+        return muladd(left.left.eval(), left.right.eval(), right.eval());
+    else if constexpr (std::is_same_v<op_t, add_op> && is_binary_v<mul_op, right_t>)
+        return muladd(right.left.eval(), right.right.eval(), left.eval());
+    else {
+
+        value_type result = left.eval();
+
+        if constexpr (std::is_same_v<op_t, add_op>)
+            result += right.eval();
+        else if constexpr (std::is_same_v<op_t, sub_op>)
+            result -= right.eval();
+        else if constexpr (std::is_same_v<op_t, mul_op>)
+            result *= right.eval();
+        else if constexpr (std::is_same_v<op_t, div_op>)
+            result /= right.eval();
+        else if constexpr (std::is_same_v<op_t, mod_op>)
+            result %= right.eval();
+
+        return result;
+    }
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+template<typename op_t, typename left_t, typename right_t>
+constexpr binary<op_t, left_t, right_t>::operator value_type() const noexcept
+{
+    return eval();
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// shift class
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+template<typename op_t, typename expr_t>
+constexpr typename shift<op_t, expr_t>::value_type shift<op_t, expr_t>::eval() const noexcept
+{
+    if constexpr (std::is_same_v<op_t, shr_op> && is_binary_v<add_op, expr_t> && is_unsigned_v<value_type>)
+        return addshr(expr.left.eval(), expr.right.eval(), count);
+    else {
+
+        value_type result = expr.eval();
+
+        if constexpr (std::is_same_v<op_t, shl_op>)
+            result <<= count;
+        else
+            result >>= count;
+
+        return result;
+    }
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+template<typename op_t, typename expr_t>
+constexpr shift<op_t, expr_t>::operator value_type() const noexcept
+{
+    return eval();
+}
+
+
+
+namespace impl
+{
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// expression construction helpers
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+template<typename value_t, typename type_t>
+constexpr auto make_operand(const type_t& value) noexcept
+{
+    if constexpr (is_expression_v<type_t>)
+        return value;
+    else
+        return term<value_t>{ value_t(value) };
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+template<typename op_t, typename left_t, typename right_t>
+constexpr auto make_binary(const left_t& left, const right_t& right) noexcept
+{
+    using value_t = typename std::conditional_t<is_expression_v<left_t>, left_t, right_t>::value_type;
+
+    auto left_operand = make_operand<value_t>(left);
+    auto right_operand = make_operand<value_t>(right);
+
+    return binary<op_t, decltype(left_operand), decltype(right_operand)>{ left_operand, right_operand };
+}
+
+} // namespace impl
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// standalone methods
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+template<typename type_t, std::enable_if_t<is_long_integer_v<type_t>, int>>
+constexpr term<type_t> lazy(const type_t& value) noexcept
+{
+    return term<type_t>{ value };
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+template<typename expr_t, std::enable_if_t<is_expression_v<expr_t>, int>>
+constexpr typename expr_t::value_type eval(const expr_t& expr) noexcept
+{
+    return expr.eval();
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+template<typename left_t, typename right_t, std::enable_if_t<is_operands_v<left_t, right_t>, int>>
+constexpr auto operator+(const left_t& left, const right_t& right) noexcept
+{
+    return impl::make_binary<add_op>(left, right);
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+template<typename left_t, typename right_t, std::enable_if_t<is_operands_v<left_t, right_t>, int>>
+constexpr auto operator-(const left_t& left, const right_t& right) noexcept
+{
+    return impl::make_binary<sub_op>(left, right);
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+template<typename left_t, typename right_t, std::enable_if_t<is_operands_v<left_t, right_t>, int>>
+constexpr auto operator*(const left_t& left, const right_t& right) noexcept
+{
+    return impl::make_binary<mul_op>(left, right);
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+template<typename left_t, typename right_t, std::enable_if_t<is_operands_v<left_t, right_t>, int>>
+constexpr auto operator/(const left_t& left, const right_t& right) noexcept
+{
+    return impl::make_binary<div_op>(left, right);
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+template<typename left_t, typename right_t, std::enable_if_t<is_operands_v<left_t, right_t>, int>>
+constexpr auto operator%(const left_t& left, const right_t& right) noexcept
+{
+    return impl::make_binary<mod_op>(left, right);
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+template<typename expr_t, std::enable_if_t<is_expression_v<expr_t>, int>>
+constexpr shift<shl_op, expr_t> operator<<(const expr_t& expr, uint_t count) noexcept
+{
+    return shift<shl_op, expr_t>{ expr, count };
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+template<typename expr_t, std::enable_if_t<is_expression_v<expr_t>, int>>
+constexpr shift<shr_op, expr_t> operator>>(const expr_t& expr, uint_t count) noexcept
+{
+    return shift<shr_op, expr_t>{ expr, count };
+}
+
+} // namespace expr
+} // namespace slim
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// End of long_expr.h
+////////////////////////////////////////////////////////////////////////////////////////////////////
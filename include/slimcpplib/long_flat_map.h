@@ -0,0 +1,485 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// Simple Long Integer Math for C++
+// version 2.0
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// Licensed under the MIT License <http://opensource.org/licenses/MIT>.
+// SPDX-License-Identifier: MIT
+//
+// Copyright (c) 2020-2026 Yury Kalmykov <y_kalmykov@mail.ru>.
+//
+// Permission is hereby  granted, free of charge, to any  person obtaining a copy
+// of this software and associated  documentation files (the "Software"), to deal
+// in the Software  without restriction, including without  limitation the rights
+// to  use, copy,  modify, merge,  publish, distribute,  sublicense, and/or  sell
+// copies  of  the Software,  and  to  permit persons  to  whom  the Software  is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE  IS PROVIDED "AS  IS", WITHOUT WARRANTY  OF ANY KIND,  EXPRESS OR
+// IMPLIED,  INCLUDING BUT  NOT  LIMITED TO  THE  WARRANTIES OF  MERCHANTABILITY,
+// FITNESS FOR  A PARTICULAR PURPOSE AND  NONINFRINGEMENT. IN NO EVENT  SHALL THE
+// AUTHORS  OR COPYRIGHT  HOLDERS  BE  LIABLE FOR  ANY  CLAIM,  DAMAGES OR  OTHER
+// LIABILITY, WHETHER IN AN ACTION OF  CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE  OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+
+#pragma once
+
+#include "long_int.h"
+#include "long_uint.h"
+
+#include <algorithm>
+#include <bit>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+#if defined(__SSE2__) || defined(_M_X64)
+#include <emmintrin.h>
+#endif // defined(__SSE2__) || defined(_M_X64)
+
+namespace slim
+{
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// flat_map class
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+// open addressing hash map with long integer keys: keys and values are stored inline in a single
+// array, a parallel array of control bytes holds 7-bit tags of hashes or empty and deleted marks;
+// lookups compare tags of a group of 16 slots at once with SSE2 (or a portable loop), so keys are
+// only compared for matching tags; any key value is allowed, mapped type must be default
+// constructible
+
+template<typename key_t, typename value_t>
+class flat_map
+{
+    static_assert(is_long_integer_v<key_t>, "flat_map requires long integer keys");
+
+public:
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    // type and constant definition
+
+    using key_type = key_t;
+    using mapped_type = value_t;
+    using slot_type = std::pair<key_t, value_t>;
+
+    // number of slots whose tags are compared at once, capacity is a power of two multiple of it
+    static constexpr size_t group_size = 16;
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    // construction/destruction
+
+    flat_map() noexcept = default;
+    explicit flat_map(size_t element_count);
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    // public methods
+
+    size_t size() const noexcept;
+    bool empty() const noexcept;
+    size_t capacity() const noexcept;
+
+    // return pointer to value of key or nullptr
+    value_t* find(const key_t& key) noexcept;
+    const value_t* find(const key_t& key) const noexcept;
+    bool contains(const key_t& key) const noexcept;
+
+    // insert value if key is absent, return pointer to value of key and whether it was inserted
+    std::pair<value_t*, bool> insert(const key_t& key, const value_t& value);
+    value_t& operator[](const key_t& key);
+    bool erase(const key_t& key) noexcept;
+
+    void clear() noexcept;
+
+    // make room for elements without rehashing, maximum load factor including deleted slots is 7/8
+    void reserve(size_t element_count);
+
+    // call function(key, value) for every element in unspecified order
+    template<typename function_t>
+    void for_each(const function_t& function) const;
+
+private:
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    // private methods
+
+    size_t find_slot(const key_t& key, size_t key_hash) const noexcept;
+    size_t free_slot(size_t key_hash) const noexcept;
+    void rehash(size_t new_capacity);
+
+private:
+    std::vector<int8_t> controls;
+    std::vector<slot_type> slots;
+    size_t count = 0;
+    size_t deleted_count = 0;
+};
+
+namespace impl
+{
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// constants
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+// control bytes of full slots are 7-bit tags, free slots have the sign bit set
+
+constexpr int8_t flat_empty = -128;
+constexpr int8_t flat_deleted = -2;
+constexpr size_t flat_none = ~size_t(0);
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// standalone helper methods
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+// bit masks of slots in a group of 16 control bytes: with tag, empty and empty or deleted
+
+uint32_t flat_match(const int8_t* group, int8_t tag) noexcept;
+uint32_t flat_match_empty(const int8_t* group) noexcept;
+uint32_t flat_match_free(const int8_t* group) noexcept;
+
+} // namespace impl
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// flat_map class
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// construction/destruction
+
+template<typename key_t, typename value_t>
+inline flat_map<key_t, value_t>::flat_map(size_t element_count)
+{
+    reserve(element_count);
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// public methods
+
+template<typename key_t, typename value_t>
+inline size_t flat_map<key_t, value_t>::size() const noexcept
+{
+    return count;
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+template<typename key_t, typename value_t>
+inline bool flat_map<key_t, value_t>::empty() const noexcept
+{
+    return count == 0;
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+template<typename key_t, typename value_t>
+inline size_t flat_map<key_t, value_t>::capacity() const noexcept
+{
+    return slots.size();
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+template<typename key_t, typename value_t>
+inline value_t* flat_map<key_t, value_t>::find(const key_t& key) noexcept
+{
+    const size_t index = find_slot(key, hash(key));
+
+    return index != impl::flat_none ? &slots[index].second : nullptr;
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+template<typename key_t, typename value_t>
+inline const value_t* flat_map<key_t, value_t>::find(const key_t& key) const noexcept
+{
+    const size_t index = find_slot(key, hash(key));
+
+    return index != impl::flat_none ? &slots[index].second : nullptr;
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+template<typename key_t, typename value_t>
+inline bool flat_map<key_t, value_t>::contains(const key_t& key) const noexcept
+{
+    return find_slot(key, hash(key)) != impl::flat_none;
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+template<typename key_t, typename value_t>
+inline std::pair<value_t*, bool> flat_map<key_t, value_t>::insert(const key_t& key, const value_t& value)
+{
+    const size_t key_hash = hash(key);
+    const size_t index = find_slot(key, key_hash);
+
+    if (index != impl::flat_none)
+        return { &slots[index].second, false };
+
+    // deleted slots are dropped by rehashing into the same capacity if they take most of the load
+
+    if ((count + deleted_count + 1) * 8 > capacity() * 7)
+        rehash((count + 1) * 16 > capacity() * 7 ? std::max(capacity() * 2, group_size) : capacity());
+
+    const size_t free_index = free_slot(key_hash);
+
+    deleted_count -= controls[free_index] == impl::flat_deleted;
+    controls[free_index] = static_cast<int8_t>(key_hash & 0x7f);
+    slots[free_index] = { key, value };
+    ++count;
+
+    return { &slots[free_index].second, true };
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+template<typename key_t, typename value_t>
+inline value_t& flat_map<key_t, value_t>::operator[](const key_t& key)
+{
+    return *insert(key, value_t()).first;
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+template<typename key_t, typename value_t>
+inline bool flat_map<key_t, value_t>::erase(const key_t& key) noexcept
+{
+    const size_t index = find_slot(key, hash(key));
+
+    if (index == impl::flat_none)
+        return false;
+
+    // lookups stop at groups with empty slots, so such a group needs no deleted mark
+
+    const size_t group = index / group_size * group_size;
+
+    if (impl::flat_match_empty(&controls[group]) != 0)
+        controls[index] = impl::flat_empty;
+    else {
+
+        controls[index] = impl::flat_deleted;
+        ++deleted_count;
+    }
+
+    slots[index] = slot_type();
+    --count;
+
+    return true;
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+template<typename key_t, typename value_t>
+inline void flat_map<key_t, value_t>::clear() noexcept
+{
+    std::fill(controls.begin(), controls.end(), impl::flat_empty);
+    std::fill(slots.begin(), slots.end(), slot_type());
+
+    count = 0;
+    deleted_count = 0;
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+template<typename key_t, typename value_t>
+inline void flat_map<key_t, value_t>::reserve(size_t element_count)
+{
+    size_t new_capacity = std::max(capacity(), group_size);
+
+    while (element_count * 8 > new_capacity * 7)
+        new_capacity *= 2;
+
+    if (new_capacity != capacity())
+        rehash(new_capacity);
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+template<typename key_t, typename value_t>
+template<typename function_t>
+inline void flat_map<key_t, value_t>::for_each(const function_t& function) const
+{
+    for (size_t index = 0; index < slots.size(); ++index) {
+
+        if (controls[index] >= 0)
+            function(slots[index].first, slots[index].second);
+    }
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// private methods
+
+template<typename key_t, typename value_t>
+inline size_t flat_map<key_t, value_t>::find_slot(const key_t& key, size_t key_hash) const noexcept
+{
+    if (slots.empty())
+        return impl::flat_none;
+
+    // groups are probed in triangular order, which visits every group of power of two count
+
+    const size_t group_mask = slots.size() / group_size - 1;
+    const int8_t tag = static_cast<int8_t>(key_hash & 0x7f);
+
+    for (size_t group = (key_hash >> 7) & group_mask, step = 1;; group = (group + step++) & group_mask) {
+
+        const int8_t* group_controls = &controls[group * group_size];
+
+        for (uint32_t mask = impl::flat_match(group_controls, tag); mask != 0; mask &= mask - 1) {
+
+            const size_t index = group * group_size + std::countr_zero(mask);
+
+            if (slots[index].first == key)
+                return index;
+        }
+
+        if (impl::flat_match_empty(group_controls) != 0)
+            return impl::flat_none;
+    }
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+template<typename key_t, typename value_t>
+inline size_t flat_map<key_t, value_t>::free_slot(size_t key_hash) const noexcept
+{
+    const size_t group_mask = slots.size() / group_size - 1;
+
+    for (size_t group = (key_hash >> 7) & group_mask, step = 1;; group = (group + step++) & group_mask) {
+
+        const uint32_t mask = impl::flat_match_free(&controls[group * group_size]);
+
+        if (mask != 0)
+            return group * group_size + std::countr_zero(mask);
+    }
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+template<typename key_t, typename value_t>
+inline void flat_map<key_t, value_t>::rehash(size_t new_capacity)
+{
+    std::vector<int8_t> old_controls(new_capacity, impl::flat_empty);
+    std::vector<slot_type> old_slots(new_capacity);
+
+    // new arrays take place of the old ones, which are moved from
+
+    controls.swap(old_controls);
+    slots.swap(old_slots);
+    deleted_count = 0;
+
+    for (size_t index = 0; index < old_slots.size(); ++index) {
+
+        if (old_controls[index] < 0)
+            continue;
+
+        const size_t free_index = free_slot(hash(old_slots[index].first));
+
+        controls[free_index] = old_controls[index];
+        slots[free_index] = std::move(old_slots[index]);
+    }
+}
+
+
+
+namespace impl
+{
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// standalone helper methods
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#if defined(__SSE2__) || defined(_M_X64)
+
+inline uint32_t flat_match(const int8_t* group, int8_t tag) noexcept
+{
+    const __m128i controls = _mm_loadu_si128(reinterpret_cast<const __m128i*>(group));
+
+    return static_cast<uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(controls, _mm_set1_epi8(tag))));
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+inline uint32_t flat_match_empty(const int8_t* group) noexcept
+{
+    return flat_match(group, flat_empty);
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+inline uint32_t flat_match_free(const int8_t* group) noexcept
+{
+    // sign bits of control bytes are set for free slots only
+
+    const __m128i controls = _mm_loadu_si128(reinterpret_cast<const __m128i*>(group));
+
+    return static_cast<uint32_t>(_mm_movemask_epi8(controls));
+}
+
+#else
+
+inline uint32_t flat_match(const int8_t* group, int8_t tag) noexcept
+{
+    uint32_t mask = 0;
+
+    for (uint_t n = 0; n < 16; ++n)
+        mask |= uint32_t(group[n] == tag) << n;
+
+    return mask;
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+inline uint32_t flat_match_empty(const int8_t* group) noexcept
+{
+    return flat_match(group, flat_empty);
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+inline uint32_t flat_match_free(const int8_t* group) noexcept
+{
+    uint32_t mask = 0;
+
+    for (uint_t n = 0; n < 16; ++n)
+        mask |= uint32_t(group[n] < 0) << n;
+
+    return mask;
+}
+
+#endif // defined(__SSE2__) || defined(_M_X64)
+
+} // namespace impl
+} // namespace slim
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// End of long_flat_map.h
+////////////////////////////////////////////////////////////////////////////////////////////////////
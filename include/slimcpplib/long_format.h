@@ -0,0 +1,275 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// Simple Long Integer Math for C++
+// version 2.0
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// Licensed under the MIT License <http://opensource.org/licenses/MIT>.
+// SPDX-License-Identifier: MIT
+//
+// Copyright (c) 2020-2026 Yury Kalmykov <y_kalmykov@mail.ru>.
+//
+// Permission is hereby  granted, free of charge, to any  person obtaining a copy
+// of this software and associated  documentation files (the "Software"), to deal
+// in the Software  without restriction, including without  limitation the rights
+// to  use, copy,  modify, merge,  publish, distribute,  sublicense, and/or  sell
+// copies  of  the Software,  and  to  permit persons  to  whom  the Software  is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE  IS PROVIDED "AS  IS", WITHOUT WARRANTY  OF ANY KIND,  EXPRESS OR
+// IMPLIED,  INCLUDING BUT  NOT  LIMITED TO  THE  WARRANTIES OF  MERCHANTABILITY,
+// FITNESS FOR  A PARTICULAR PURPOSE AND  NONINFRINGEMENT. IN NO EVENT  SHALL THE
+// AUTHORS  OR COPYRIGHT  HOLDERS  BE  LIABLE FOR  ANY  CLAIM,  DAMAGES OR  OTHER
+// LIABILITY, WHETHER IN AN ACTION OF  CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE  OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+#pragma once
+
+#include "long_charconv.h"
+#include "long_uint.h"
+
+#include <array>
+#include <version>
+
+#if defined(__cpp_lib_format)
+#include <format>
+#endif
+
+namespace slim
+{
+namespace impl
+{
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// struct format_spec_t
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+// standard format specification of integers: [[fill]align][sign][#][0][width][type]
+
+template<typename char_t>
+struct format_spec_t {
+    char_t fill = char_t(' ');
+    char align = 0;
+    char sign = '-';
+    bool alternate = false;
+    bool zero_padding = false;
+    uint_t width = 0;
+    char type = 'd';
+};
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// standalone helper methods
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+template<typename iterator_t, typename char_t>
+constexpr bool parse_format_spec(iterator_t& first, iterator_t last, format_spec_t<char_t>& spec) noexcept;
+template<typename output_t, typename native_t, uint_t size, typename char_t>
+constexpr output_t write_format(output_t out, const long_uint_t<native_t, size>& magnitude, bool negative, const format_spec_t<char_t>& spec);
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+template<typename iterator_t, typename char_t>
+constexpr bool parse_format_spec(iterator_t& first, iterator_t last, format_spec_t<char_t>& spec) noexcept
+{
+    const auto is_align = [](char_t ch) {
+        return ch == char_t('<') || ch == char_t('>') || ch == char_t('^');
+    };
+
+    // fill character is recognized only when followed by alignment
+
+    if (first != last && first + 1 != last && *first != char_t('{') && *first != char_t('}') && is_align(first[1])) {
+
+        spec.fill = *first;
+        spec.align = static_cast<char>(first[1]);
+        first += 2;
+
+    } else if (first != last && is_align(*first)) {
+
+        spec.align = static_cast<char>(*first);
+        ++first;
+    }
+
+    if (first != last && (*first == char_t('+') || *first == char_t('-') || *first == char_t(' ')))
+        spec.sign = static_cast<char>(*first++);
+
+    if (first != last && *first == char_t('#')) {
+
+        spec.alternate = true;
+        ++first;
+    }
+
+    if (first != last && *first == char_t('0')) {
+
+        spec.zero_padding = true;
+        ++first;
+    }
+
+    for (; first != last && *first >= char_t('0') && *first <= char_t('9'); ++first)
+        spec.width = spec.width * 10 + static_cast<uint_t>(*first - char_t('0'));
+
+    if (first != last && *first != char_t('}')) {
+
+        switch (*first) {
+        case char_t('d'):
+        case char_t('x'):
+        case char_t('X'):
+        case char_t('o'):
+        case char_t('b'):
+        case char_t('B'):
+            spec.type = static_cast<char>(*first++);
+            break;
+        default:
+            return false;
+        }
+    }
+
+    // precision, locale and dynamic width are not supported for integers
+
+    return first == last || *first == char_t('}');
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+template<typename output_t, typename native_t, uint_t size, typename char_t>
+constexpr output_t write_format(output_t out, const long_uint_t<native_t, size>& magnitude, bool negative, const format_spec_t<char_t>& spec)
+{
+    constexpr uint_t max_chars = bit_count_v<long_uint_t<native_t, size>>;
+
+    const bool uppercase = spec.type == 'X' || spec.type == 'B';
+    const int base = spec.type == 'x' || spec.type == 'X' ? 16 : spec.type == 'o' ? 8 : spec.type == 'b' || spec.type == 'B' ? 2 : 10;
+
+    std::array<char, max_chars> digits;
+    const uint_t digit_size = static_cast<uint_t>(to_chars(digits.data(), digits.data() + digits.size(), magnitude, base).ptr - digits.data());
+
+    // sign and base prefix precede zero padding
+
+    std::array<char, 3> prefix;
+    uint_t prefix_size = 0;
+
+    if (negative)
+        prefix[prefix_size++] = '-';
+    else if (spec.sign != '-')
+        prefix[prefix_size++] = spec.sign;
+
+    if (spec.alternate) {
+
+        if (base == 16 || base == 2) {
+
+            prefix[prefix_size++] = '0';
+            prefix[prefix_size++] = base == 16 ? (uppercase ? 'X' : 'x') : (uppercase ? 'B' : 'b');
+
+        } else if (base == 8 && magnitude != 0)
+            prefix[prefix_size++] = '0';
+    }
+
+    const uint_t content_size = prefix_size + digit_size;
+    const uint_t padding_size = spec.width > content_size ? spec.width - content_size : 0;
+    const bool zero_padding = spec.zero_padding && spec.align == 0;
+
+    uint_t leading_size = 0;
+
+    if (!zero_padding)
+        leading_size = spec.align == '<' ? 0 : spec.align == '^' ? padding_size / 2 : padding_size;
+
+    for (uint_t n = 0; n < leading_size; ++n)
+        *out++ = spec.fill;
+
+    for (uint_t n = 0; n < prefix_size; ++n)
+        *out++ = char_t(prefix[n]);
+
+    for (uint_t n = 0; zero_padding && n < padding_size; ++n)
+        *out++ = char_t('0');
+
+    for (uint_t n = 0; n < digit_size; ++n)
+        *out++ = char_t(uppercase && digits[n] >= 'a' ? digits[n] - 'a' + 'A' : digits[n]);
+
+    for (uint_t n = zero_padding ? padding_size : leading_size; n < padding_size; ++n)
+        *out++ = spec.fill;
+
+    return out;
+}
+
+} // namespace impl
+} // namespace slim
+
+#if defined(__cpp_lib_format)
+
+namespace std
+{
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// class formatter<slim::long_uint_t<type_t, size>, char_t>
+////////////////////////////////////////////////////////////////////////////////////////////////////
+template<typename type_t, slim::uint_t size, typename char_t>
+struct formatter<slim::long_uint_t<type_t, size>, char_t> {
+public:
+    using long_uint_t = slim::long_uint_t<type_t, size>;
+
+    constexpr auto parse(basic_format_parse_context<char_t>& context)
+    {
+        auto it = context.begin();
+
+        if (!slim::impl::parse_format_spec(it, context.end(), spec))
+            throw format_error("invalid format specification of long integer");
+
+        return it;
+    }
+
+    template<typename context_t>
+    auto format(const long_uint_t& value, context_t& context) const
+    {
+        return slim::impl::write_format(context.out(), value, false, spec);
+    }
+
+private:
+    slim::impl::format_spec_t<char_t> spec;
+};
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// class formatter<slim::long_int_t<type_t, size>, char_t>
+////////////////////////////////////////////////////////////////////////////////////////////////////
+template<typename type_t, slim::uint_t size, typename char_t>
+struct formatter<slim::long_int_t<type_t, size>, char_t> {
+public:
+    using long_uint_t = slim::long_uint_t<type_t, size>;
+    using long_int_t = slim::long_int_t<type_t, size>;
+
+    constexpr auto parse(basic_format_parse_context<char_t>& context)
+    {
+        auto it = context.begin();
+
+        if (!slim::impl::parse_format_spec(it, context.end(), spec))
+            throw format_error("invalid format specification of long integer");
+
+        return it;
+    }
+
+    template<typename context_t>
+    auto format(const long_int_t& value, context_t& context) const
+    {
+        return slim::impl::write_format(context.out(), value.sign() ? long_uint_t(-value) : long_uint_t(value), value.sign(), spec);
+    }
+
+private:
+    slim::impl::format_spec_t<char_t> spec;
+};
+
+} // namespace std
+
+#endif // defined(__cpp_lib_format)
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// End of long_format.h
+////////////////////////////////////////////////////////////////////////////////////////////////////
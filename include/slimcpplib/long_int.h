@@ -83,11 +83,15 @@ public:
     constexpr long_int_t negate() const noexcept;
     template<uint_t other_size, std::enable_if_t<(other_size < size), int> = 0>
     explicit constexpr operator long_int_t<native_t, other_size>() const noexcept;
-    template<typename type_t, std::enable_if_t<std::is_signed_v<type_t>, int> = 0>
+    template<typename type_t, std::enable_if_t<std::is_integral_v<type_t> && std::is_signed_v<type_t>, int> = 0>
+    explicit constexpr operator type_t() const noexcept;
+    template<typename type_t, std::enable_if_t<std::is_floating_point_v<type_t>, int> = 0>
     explicit constexpr operator type_t() const noexcept;
     constexpr bool operator==(const long_int_t& that) const noexcept;
     template<typename type_t, std::enable_if_t<is_integer_v<type_t> && byte_count_v<type_t> <= byte_count_v<native_t>, int> = 0>
     constexpr bool operator==(type_t value) const noexcept;
+    template<uint_t other_size, std::enable_if_t<(other_size < size), int> = 0>
+    constexpr bool operator==(const long_int_t<native_t, other_size>& that) const noexcept;
     constexpr bool operator!=(const long_int_t& that) const noexcept;
     template<typename type_t, std::enable_if_t<is_integer_v<type_t> && byte_count_v<type_t> <= byte_count_v<native_t>, int> = 0>
     constexpr bool operator!=(type_t value) const noexcept;
@@ -95,6 +99,11 @@ public:
     constexpr bool operator<=(const long_int_t& that) const noexcept;
     constexpr bool operator>(const long_int_t& that) const noexcept;
     constexpr bool operator>=(const long_int_t& that) const noexcept;
+    constexpr std::strong_ordering operator<=>(const long_int_t& that) const noexcept;
+    template<uint_t other_size, std::enable_if_t<(other_size < size), int> = 0>
+    constexpr std::strong_ordering operator<=>(const long_int_t<native_t, other_size>& that) const noexcept;
+    template<typename type_t, std::enable_if_t<std::is_integral_v<type_t> && byte_count_v<type_t> <= byte_count_v<native_t>, int> = 0>
+    constexpr std::strong_ordering operator<=>(type_t value) const noexcept;
     constexpr long_int_t& operator<<=(uint_t shift) noexcept;
     constexpr long_int_t operator<<(uint_t shift) const noexcept;
     constexpr long_int_t& operator>>=(uint_t shift) noexcept;
@@ -105,6 +114,10 @@ public:
     constexpr long_int_t operator+(const long_int_t& that) const noexcept;
     template<typename type_t, std::enable_if_t<is_integer_v<type_t> && byte_count_v<type_t> <= byte_count_v<native_t>, int> = 0>
     constexpr long_int_t operator+(type_t value) const noexcept;
+    template<uint_t other_size, std::enable_if_t<(other_size < size), int> = 0>
+    constexpr long_int_t& operator+=(const long_int_t<native_t, other_size>& that) noexcept;
+    template<uint_t other_size, std::enable_if_t<(other_size < size), int> = 0>
+    constexpr long_int_t operator+(const long_int_t<native_t, other_size>& that) const noexcept;
     constexpr long_int_t& operator++() noexcept;
     constexpr long_int_t operator++(int) noexcept;
     constexpr long_int_t operator+() const noexcept;
@@ -114,11 +127,19 @@ public:
     constexpr long_int_t operator-(const long_int_t& that) const noexcept;
     template<typename type_t, std::enable_if_t<is_integer_v<type_t> && byte_count_v<type_t> <= byte_count_v<native_t>, int> = 0>
     constexpr long_int_t operator-(type_t value) const noexcept;
+    template<uint_t other_size, std::enable_if_t<(other_size < size), int> = 0>
+    constexpr long_int_t& operator-=(const long_int_t<native_t, other_size>& that) noexcept;
+    template<uint_t other_size, std::enable_if_t<(other_size < size), int> = 0>
+    constexpr long_int_t operator-(const long_int_t<native_t, other_size>& that) const noexcept;
     constexpr long_int_t& operator--() noexcept;
     constexpr long_int_t operator--(int) noexcept;
     constexpr long_int_t operator-() const noexcept;
     constexpr long_int_t& operator*=(const long_int_t& that) noexcept;
     constexpr long_int_t operator*(const long_int_t& that) const noexcept;
+    template<uint_t other_size, std::enable_if_t<(other_size < size), int> = 0>
+    constexpr long_int_t& operator*=(const long_int_t<native_t, other_size>& that) noexcept;
+    template<uint_t other_size, std::enable_if_t<(other_size < size), int> = 0>
+    constexpr long_int_t operator*(const long_int_t<native_t, other_size>& that) const noexcept;
     constexpr long_int_t& operator/=(const long_int_t& that) noexcept;
     constexpr long_int_t operator/(const long_int_t& that) const noexcept;
     constexpr long_int_t& operator%=(const long_int_t& that) noexcept;
@@ -134,6 +155,24 @@ public:
 template<typename type_t, std::enable_if_t<is_signed_v<type_t>, int> = 0>
 constexpr type_t muldiv(const type_t& value, const type_t& multiplier, const type_t& divider) noexcept;
 
+// convert to floating point value rounded to nearest (ties to even)
+
+template<typename float_t, typename native_t, uint_t size, std::enable_if_t<std::is_floating_point_v<float_t>, int> = 0>
+constexpr float_t to_floating(const long_int_t<native_t, size>& value) noexcept;
+template<typename native_t, uint_t size>
+constexpr float to_float(const long_int_t<native_t, size>& value) noexcept;
+template<typename native_t, uint_t size>
+constexpr double to_double(const long_int_t<native_t, size>& value) noexcept;
+template<typename native_t, uint_t size>
+constexpr long double to_long_double(const long_int_t<native_t, size>& value) noexcept;
+
+// convert from floating point value truncated toward zero (NaN gives zero, out of range values saturate)
+
+template<typename type_t, typename float_t, std::enable_if_t<is_signed_v<type_t> && std::is_floating_point_v<float_t>, int> = 0>
+constexpr type_t from_floating(float_t value) noexcept;
+template<typename type_t, std::enable_if_t<is_signed_v<type_t>, int> = 0>
+constexpr type_t from_double(double value) noexcept;
+
 
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -235,7 +274,7 @@ constexpr long_int_t<native_t, size>::operator long_int_t<native_t, other_size>(
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 template<typename native_t, uint_t size>
-template<typename type_t, std::enable_if_t<std::is_signed_v<type_t>, int>>
+template<typename type_t, std::enable_if_t<std::is_integral_v<type_t> && std::is_signed_v<type_t>, int>>
 constexpr long_int_t<native_t, size>::operator type_t() const noexcept
 {
     return static_cast<type_t>(digits[lo]);
@@ -243,6 +282,16 @@ constexpr long_int_t<native_t, size>::operator type_t() const noexcept
 
 
 
+////////////////////////////////////////////////////////////////////////////////////////////////////
+template<typename native_t, uint_t size>
+template<typename type_t, std::enable_if_t<std::is_floating_point_v<type_t>, int>>
+constexpr long_int_t<native_t, size>::operator type_t() const noexcept
+{
+    return to_floating<type_t>(*this);
+}
+
+
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 template<typename native_t, uint_t size>
 constexpr bool long_int_t<native_t, size>::operator==(const long_int_t& that) const noexcept
@@ -262,6 +311,30 @@ constexpr bool long_int_t<native_t, size>::operator==(type_t value) const noexce
 
 
 
+////////////////////////////////////////////////////////////////////////////////////////////////////
+template<typename native_t, uint_t size>
+template<uint_t other_size, std::enable_if_t<(other_size < size), int>>
+constexpr bool long_int_t<native_t, size>::operator==(const long_int_t<native_t, other_size>& that) const noexcept
+{
+    const native_t extension = that.sign() ? native_t(~native_t(0)) : native_t(0);
+
+    for (uint_t n = std::size(digits); n-- > other_size;) {
+
+        if (digits[n] != extension)
+            return false;
+    }
+
+    for (uint_t n = other_size; n-- > 0;) {
+
+        if (digits[n] != that.digits[n])
+            return false;
+    }
+
+    return true;
+}
+
+
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 template<typename native_t, uint_t size>
 constexpr bool long_int_t<native_t, size>::operator!=(const long_int_t& that) const noexcept
@@ -317,6 +390,93 @@ constexpr bool long_int_t<native_t, size>::operator>=(const long_int_t& that) co
 
 
 
+////////////////////////////////////////////////////////////////////////////////////////////////////
+template<typename native_t, uint_t size>
+constexpr std::strong_ordering long_int_t<native_t, size>::operator<=>(const long_int_t& that) const noexcept
+{
+    using signed_t = make_signed_t<native_t>;
+
+    // the most significant digit carries the sign and is compared as signed
+
+    const signed_t digit_hi = static_cast<signed_t>(digits[hi]);
+    const signed_t that_digit_hi = static_cast<signed_t>(that.digits[hi]);
+    int_t order = int_t(digit_hi > that_digit_hi) - int_t(digit_hi < that_digit_hi);
+
+    for (uint_t n = hi; n-- > 0;) {
+
+        const int_t digit_order = int_t(digits[n] > that.digits[n]) - int_t(digits[n] < that.digits[n]);
+        order = order != 0 ? order : digit_order;
+    }
+
+    return order <=> 0;
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+template<typename native_t, uint_t size>
+template<uint_t other_size, std::enable_if_t<(other_size < size), int>>
+constexpr std::strong_ordering long_int_t<native_t, size>::operator<=>(const long_int_t<native_t, other_size>& that) const noexcept
+{
+    using signed_t = make_signed_t<native_t>;
+
+    // upper digits are compared with the sign extension of shorter value
+
+    const native_t extension = that.sign() ? native_t(~native_t(0)) : native_t(0);
+    const signed_t digit_hi = static_cast<signed_t>(digits[hi]);
+    const signed_t extension_hi = static_cast<signed_t>(extension);
+    int_t order = int_t(digit_hi > extension_hi) - int_t(digit_hi < extension_hi);
+
+    for (uint_t n = hi; n-- > other_size;) {
+
+        const int_t digit_order = int_t(digits[n] > extension) - int_t(digits[n] < extension);
+        order = order != 0 ? order : digit_order;
+    }
+
+    for (uint_t n = other_size; n-- > 0;) {
+
+        const int_t digit_order = int_t(digits[n] > that.digits[n]) - int_t(digits[n] < that.digits[n]);
+        order = order != 0 ? order : digit_order;
+    }
+
+    return order <=> 0;
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+template<typename native_t, uint_t size>
+template<typename type_t, std::enable_if_t<std::is_integral_v<type_t> && byte_count_v<type_t> <= byte_count_v<native_t>, int>>
+constexpr std::strong_ordering long_int_t<native_t, size>::operator<=>(type_t value) const noexcept
+{
+    using signed_t = make_signed_t<native_t>;
+
+    native_t extension = native_t(0);
+
+    if constexpr (std::is_signed_v<type_t>) {
+
+        if (value < 0)
+            extension = native_t(~native_t(0));
+    }
+
+    const signed_t digit_hi = static_cast<signed_t>(digits[hi]);
+    const signed_t extension_hi = static_cast<signed_t>(extension);
+    int_t order = int_t(digit_hi > extension_hi) - int_t(digit_hi < extension_hi);
+
+    for (uint_t n = hi; n-- > 1;) {
+
+        const int_t digit_order = int_t(digits[n] > extension) - int_t(digits[n] < extension);
+        order = order != 0 ? order : digit_order;
+    }
+
+    const int_t digit_order = int_t(digits[lo] > native_t(value)) - int_t(digits[lo] < native_t(value));
+    order = order != 0 ? order : digit_order;
+
+    return order <=> 0;
+}
+
+
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 template<typename native_t, uint_t size>
 constexpr long_int_t<native_t, size>& long_int_t<native_t, size>::operator<<=(uint_t shift) noexcept
@@ -415,6 +575,42 @@ constexpr long_int_t<native_t, size> long_int_t<native_t, size>::operator+(type_
 
 
 
+////////////////////////////////////////////////////////////////////////////////////////////////////
+template<typename native_t, uint_t size>
+template<uint_t other_size, std::enable_if_t<(other_size < size), int>>
+constexpr long_int_t<native_t, size>& long_int_t<native_t, size>::operator+=(const long_int_t<native_t, other_size>& that) noexcept
+{
+    add(digits, that.digits);
+
+    // sign extension of negative value adds all ones to the upper digits, that is subtracts one
+
+    if (that.sign()) {
+
+        bool borrow = true;
+
+        for (uint_t n = other_size; borrow && n < std::size(digits); ++n)
+            borrow = sub(digits[n], native_t(1));
+    }
+
+    return *this;
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+template<typename native_t, uint_t size>
+template<uint_t other_size, std::enable_if_t<(other_size < size), int>>
+constexpr long_int_t<native_t, size> long_int_t<native_t, size>::operator+(const long_int_t<native_t, other_size>& that) const noexcept
+{
+    long_int_t tmp = *this;
+
+    tmp += that;
+
+    return tmp;
+}
+
+
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 template<typename native_t, uint_t size>
 constexpr long_int_t<native_t, size>& long_int_t<native_t, size>::operator++() noexcept
@@ -498,6 +694,42 @@ constexpr long_int_t<native_t, size> long_int_t<native_t, size>::operator-(type_
 
 
 
+////////////////////////////////////////////////////////////////////////////////////////////////////
+template<typename native_t, uint_t size>
+template<uint_t other_size, std::enable_if_t<(other_size < size), int>>
+constexpr long_int_t<native_t, size>& long_int_t<native_t, size>::operator-=(const long_int_t<native_t, other_size>& that) noexcept
+{
+    sub(digits, that.digits);
+
+    // sign extension of negative value subtracts all ones from the upper digits, that is adds one
+
+    if (that.sign()) {
+
+        bool carry = true;
+
+        for (uint_t n = other_size; carry && n < std::size(digits); ++n)
+            carry = add(digits[n], native_t(1));
+    }
+
+    return *this;
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+template<typename native_t, uint_t size>
+template<uint_t other_size, std::enable_if_t<(other_size < size), int>>
+constexpr long_int_t<native_t, size> long_int_t<native_t, size>::operator-(const long_int_t<native_t, other_size>& that) const noexcept
+{
+    long_int_t tmp = *this;
+
+    tmp -= that;
+
+    return tmp;
+}
+
+
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 template<typename native_t, uint_t size>
 constexpr long_int_t<native_t, size>& long_int_t<native_t, size>::operator--() noexcept
@@ -559,6 +791,44 @@ constexpr long_int_t<native_t, size> long_int_t<native_t, size>::operator*(const
 
 
 
+////////////////////////////////////////////////////////////////////////////////////////////////////
+template<typename native_t, uint_t size>
+template<uint_t other_size, std::enable_if_t<(other_size < size), int>>
+constexpr long_int_t<native_t, size>& long_int_t<native_t, size>::operator*=(const long_int_t<native_t, other_size>& that) noexcept
+{
+    const native_array_t value = digits;
+
+    mul(digits, that.digits);
+
+    // sign extension of negative value subtracts this value shifted to the upper digits
+
+    if (that.sign()) {
+
+        bool borrow = false;
+
+        for (uint_t n = other_size; n < std::size(digits); ++n)
+            borrow = subb(digits[n], value[n - other_size], borrow);
+    }
+
+    return *this;
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+template<typename native_t, uint_t size>
+template<uint_t other_size, std::enable_if_t<(other_size < size), int>>
+constexpr long_int_t<native_t, size> long_int_t<native_t, size>::operator*(const long_int_t<native_t, other_size>& that) const noexcept
+{
+    long_int_t tmp = *this;
+
+    tmp *= that;
+
+    return tmp;
+}
+
+
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 template<typename native_t, uint_t size>
 constexpr long_int_t<native_t, size>& long_int_t<native_t, size>::operator/=(const long_int_t& that) noexcept
@@ -802,6 +1072,82 @@ constexpr type_t muldiv(const type_t& value, const type_t& multiplier, const typ
 
 
 
+////////////////////////////////////////////////////////////////////////////////////////////////////
+template<typename float_t, typename native_t, uint_t size, std::enable_if_t<std::is_floating_point_v<float_t>, int>>
+constexpr float_t to_floating(const long_int_t<native_t, size>& value) noexcept
+{
+    using long_uint_t = long_uint_t<native_t, size>;
+
+    // rounding to nearest is symmetric, so convert the magnitude and restore the sign
+
+    if (value.sign())
+        return -to_floating<float_t>(long_uint_t(-value));
+
+    return to_floating<float_t>(long_uint_t(value));
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+template<typename native_t, uint_t size>
+constexpr float to_float(const long_int_t<native_t, size>& value) noexcept
+{
+    return to_floating<float>(value);
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+template<typename native_t, uint_t size>
+constexpr double to_double(const long_int_t<native_t, size>& value) noexcept
+{
+    return to_floating<double>(value);
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+template<typename native_t, uint_t size>
+constexpr long double to_long_double(const long_int_t<native_t, size>& value) noexcept
+{
+    return to_floating<long double>(value);
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+template<typename type_t, typename float_t, std::enable_if_t<is_signed_v<type_t> && std::is_floating_point_v<float_t>, int>>
+constexpr type_t from_floating(float_t value) noexcept
+{
+    using unsigned_t = make_unsigned_t<type_t>;
+
+    const float_t limit = impl::pow2<float_t>(bit_count_v<type_t> - 1);
+
+    if (value != value)
+        return type_t(0);
+
+    if (value >= limit)
+        return std::numeric_limits<type_t>::max();
+
+    if (value <= -limit)
+        return std::numeric_limits<type_t>::min();
+
+    const type_t magnitude = from_floating<unsigned_t>(value < 0 ? -value : value);
+
+    return value < 0 ? -magnitude : magnitude;
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+template<typename type_t, std::enable_if_t<is_signed_v<type_t>, int>>
+constexpr type_t from_double(double value) noexcept
+{
+    return from_floating<type_t>(value);
+}
+
+
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 // long integer literal accept operator
 ////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -32,8 +32,10 @@
 
 #pragma once
 
+#include "long_charconv.h"
 #include "long_uint.h"
 
+#include <algorithm>
 #include <array>
 #include <iostream>
 #include <limits>
@@ -54,16 +56,33 @@ std::basic_istream<char_t, traits_t>& operator>>(std::basic_istream<char_t, trai
 template<typename native_t, uint_t size, typename char_t, class traits_t = std::char_traits<char_t>>
 std::basic_istream<char_t, traits_t>& operator>>(std::basic_istream<char_t, traits_t>& stream, long_int_t<native_t, size>& value);
 
+// binary base manipulator, that stays active until another base is selected with std::dec, std::hex or std::oct
+
+inline std::ios_base& bin(std::ios_base& stream);
+
 namespace impl
 {
 ////////////////////////////////////////////////////////////////////////////////////////////////////
-// struct chunk_traits_t
+// get_area_access class
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 
-template<typename native_t>
-struct chunk_traits_t {
-    native_t chunk_base = 1;
-    uint_t digits_per_chunk = 0;
+// exposes get area of any stream buffer, so that input is parsed in place instead of per character calls
+
+template<typename char_t, class traits_t>
+class get_area_access : public std::basic_streambuf<char_t, traits_t>
+{
+public:
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    // type and constant definition
+
+    using streambuf_t = std::basic_streambuf<char_t, traits_t>;
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    // public methods
+
+    static const char_t* begin(streambuf_t& buffer) noexcept;
+    static const char_t* end(streambuf_t& buffer) noexcept;
+    static void consume(streambuf_t& buffer, std::ptrdiff_t count) noexcept;
 };
 
 
@@ -72,18 +91,15 @@ struct chunk_traits_t {
 // standalone helper methods
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 
-inline uint_t get_base(std::ios::fmtflags flags) noexcept;
+inline int get_binary_index();
+inline uint_t get_base(std::ios_base& stream);
 template<typename char_t>
 std::optional<uint_t> parse_digit(char_t ch, uint_t base) noexcept;
-template<typename native_t>
-chunk_traits_t<native_t> get_chunk_traits(uint_t base) noexcept;
-template<typename long_uint_t>
-bool append_chunk(long_uint_t& value, uint_t base, typename long_uint_t::native_array_t::value_type chunk, uint_t digit_count) noexcept;
 template<typename long_uint_t, typename char_t, class traits_t = std::char_traits<char_t>>
 void write_unsigned_integer(std::basic_ostream<char_t, traits_t>& stream, const long_uint_t& magnitude, const char_t* sign_prefix = nullptr, uint_t sign_prefix_size = 0);
 template<typename long_uint_t, typename char_t, class traits_t = std::char_traits<char_t>>
 std::optional<long_uint_t> read_unsigned_integer(std::basic_istream<char_t, traits_t>& stream);
-template<typename char_t, class traits_t = std::char_traits<char_t>>
+template<uint_t max_digit_size, typename char_t, class traits_t = std::char_traits<char_t>>
 void write_formatted(std::basic_ostream<char_t, traits_t>& stream, const char_t* prefix, uint_t prefix_size, const char_t* digits, uint_t digit_size);
 
 } // namespace impl
@@ -176,99 +192,115 @@ inline std::basic_istream<char_t, traits_t>& operator>>(std::basic_istream<char_
     return stream;
 }
 
+////////////////////////////////////////////////////////////////////////////////////////////////////
+inline std::ios_base& bin(std::ios_base& stream)
+{
+    // empty basefield keeps native integers decimal, while long integers check the binary flag
+
+    stream.unsetf(std::ios::basefield);
+    stream.iword(impl::get_binary_index()) = 1;
+
+    return stream;
+}
+
 namespace impl
 {
 ////////////////////////////////////////////////////////////////////////////////////////////////////
-// standalone helper methods
+// get_area_access class
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 
-inline uint_t get_base(std::ios::fmtflags flags) noexcept
-{
-    if ((flags & std::ios::basefield) == std::ios::oct)
-        return 8;
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// public methods
 
-    if ((flags & std::ios::basefield) == std::ios::hex)
-        return 16;
+template<typename char_t, class traits_t>
+inline const char_t* get_area_access<char_t, traits_t>::begin(streambuf_t& buffer) noexcept
+{
+    // protected members are accessible through pointer to member of derived class
 
-    return 10;
+    return (buffer.*(&get_area_access::gptr))();
 }
 
 
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
-template<typename char_t>
-inline std::optional<uint_t> parse_digit(char_t ch, uint_t base) noexcept
+template<typename char_t, class traits_t>
+inline const char_t* get_area_access<char_t, traits_t>::end(streambuf_t& buffer) noexcept
 {
-    if (ch >= char_t('0') && ch <= char_t('9')) {
+    return (buffer.*(&get_area_access::egptr))();
+}
 
-        const uint_t decimal_digit = ch - char_t('0');
 
-        if (decimal_digit < base)
-            return std::make_optional(decimal_digit);
 
-    } else if (ch >= char_t('A') && ch <= char_t('F')) {
+////////////////////////////////////////////////////////////////////////////////////////////////////
+template<typename char_t, class traits_t>
+inline void get_area_access<char_t, traits_t>::consume(streambuf_t& buffer, std::ptrdiff_t count) noexcept
+{
+    assert(count <= end(buffer) - begin(buffer));
 
-        const uint_t upper_hex_digit = ch - char_t('A') + 10;
+    (buffer.*(&get_area_access::gbump))(static_cast<int>(count));
+}
 
-        if (upper_hex_digit < base)
-            return std::make_optional(upper_hex_digit);
 
-    } else if (ch >= char_t('a') && ch <= char_t('f')) {
 
-        const uint_t lower_hex_digit = ch - char_t('a') + 10;
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// standalone helper methods
+////////////////////////////////////////////////////////////////////////////////////////////////////
 
-        if (lower_hex_digit < base)
-            return std::make_optional(lower_hex_digit);
-    }
+inline int get_binary_index()
+{
+    static const int binary_index = std::ios_base::xalloc();
 
-    return std::nullopt;
+    return binary_index;
 }
 
 
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
-template<typename native_t>
-inline chunk_traits_t<native_t> get_chunk_traits(uint_t base) noexcept
+inline uint_t get_base(std::ios_base& stream)
 {
-    constexpr native_t max_value = std::numeric_limits<native_t>::max();
-    chunk_traits_t<native_t> result;
+    const std::ios::fmtflags basefield = stream.flags() & std::ios::basefield;
 
-    // choose the largest base^k that still fits into a native word
+    if (basefield == std::ios::oct)
+        return 8;
 
-    while (result.chunk_base <= max_value / static_cast<native_t>(base)) {
+    if (basefield == std::ios::hex)
+        return 16;
 
-        result.chunk_base *= static_cast<native_t>(base);
-        ++result.digits_per_chunk;
-    }
+    if (basefield == std::ios::fmtflags() && stream.iword(get_binary_index()) != 0)
+        return 2;
 
-    return result;
+    return 10;
 }
 
 
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
-template<typename long_uint_t>
-inline bool append_chunk(long_uint_t& value, uint_t base, typename long_uint_t::native_array_t::value_type chunk, uint_t digit_count) noexcept
+template<typename char_t>
+inline std::optional<uint_t> parse_digit(char_t ch, uint_t base) noexcept
 {
-    using native_t = typename long_uint_t::native_array_t::value_type;
+    if (ch >= char_t('0') && ch <= char_t('9')) {
+
+        const uint_t decimal_digit = ch - char_t('0');
 
-    if (digit_count == 0)
-        return true;
+        if (decimal_digit < base)
+            return std::make_optional(decimal_digit);
 
-    // fold one parsed base^k chunk into the current wide value
+    } else if (ch >= char_t('A') && ch <= char_t('F')) {
 
-    native_t scale = 1;
-    for (uint_t idx = 0; idx < digit_count; ++idx)
-        scale *= static_cast<native_t>(base);
+        const uint_t upper_hex_digit = ch - char_t('A') + 10;
 
-    long_uint_t tmp = value;
-    const long_uint_t carry = mulc(tmp, long_uint_t(scale), long_uint_t(chunk));
+        if (upper_hex_digit < base)
+            return std::make_optional(upper_hex_digit);
 
-    if (carry > 0)
-        return false;
+    } else if (ch >= char_t('a') && ch <= char_t('f')) {
 
-    value = tmp;
-    return true;
+        const uint_t lower_hex_digit = ch - char_t('a') + 10;
+
+        if (lower_hex_digit < base)
+            return std::make_optional(lower_hex_digit);
+    }
+
+    return std::nullopt;
 }
 
 
@@ -277,54 +309,34 @@ inline bool append_chunk(long_uint_t& value, uint_t base, typename long_uint_t::
 template<typename long_uint_t, typename char_t, class traits_t>
 inline void write_unsigned_integer(std::basic_ostream<char_t, traits_t>& stream, const long_uint_t& magnitude, const char_t* sign_prefix, uint_t sign_prefix_size)
 {
-    using native_t = typename long_uint_t::native_array_t::value_type;
-
-    constexpr uint_t max_chars = bit_count_v<long_uint_t> + 5;
+    constexpr uint_t max_chars = bit_count_v<long_uint_t>;
     constexpr uint_t max_sign_prefix_size = 1;
     constexpr uint_t max_base_prefix_size = 2;
     constexpr uint_t max_prefix_size = max_sign_prefix_size + max_base_prefix_size;
-    constexpr auto upper_digits = "0123456789ABCDEF";
-    constexpr auto lower_digits = "0123456789abcdef";
 
-    const bool uppercase = (stream.flags() & std::ios::uppercase) != 0;
-    const auto digits_table = uppercase ? upper_digits : lower_digits;
-    const uint_t base = get_base(stream.flags());
-    
-    std::array<char_t, max_chars> digits_buffer;
-    char_t* digits_out = digits_buffer.data() + digits_buffer.size();
-
-    // convert the magnitude into base^k chunks and emit digits backwards
-
-    if (magnitude == 0) {
-
-        *--digits_out = char_t('0');
-
-    } else {
+    // use the standard formatted-output guard to honor stream state and flush tied streams
 
-        const chunk_traits_t<native_t> traits = get_chunk_traits<native_t>(base);
-        
-        long_uint_t remainder = magnitude;
-        long_uint_t chunk;
+    const typename std::basic_ostream<char_t, traits_t>::sentry guard(stream);
 
-        while (remainder != 0) {
+    if (!guard)
+        return;
 
-            remainder = divqr(remainder, long_uint_t(traits.chunk_base), chunk);
-            native_t chunk_value = static_cast<native_t>(chunk);
-            uint_t digit_count = traits.digits_per_chunk;
+    const bool uppercase = (stream.flags() & std::ios::uppercase) != 0;
+    const uint_t base = get_base(stream);
 
-            do {
+    // format the magnitude with to_chars, then apply the letter case and widen to the stream characters
 
-                *--digits_out = char_t(digits_table[static_cast<uint_t>(chunk_value % static_cast<native_t>(base))]);
-                chunk_value /= static_cast<native_t>(base);
+    std::array<char, max_chars> chars;
+    const std::to_chars_result result = to_chars(chars.data(), chars.data() + chars.size(), magnitude, static_cast<int>(base));
+    const uint_t digit_size = static_cast<uint_t>(result.ptr - chars.data());
 
-                if (digit_count > 0)
-                    --digit_count;
+    std::array<char_t, max_chars> digits_buffer;
+    char_t* const digits = digits_buffer.data();
 
-            } while (chunk_value > 0 || digit_count > 0);
-        }
+    for (uint_t idx = 0; idx < digit_size; ++idx) {
 
-        while ((digits_buffer.data() + digits_buffer.size() - digits_out) > 1 && *digits_out == char_t('0'))
-            ++digits_out;
+        const char ch = chars[idx];
+        digits[idx] = char_t(uppercase && ch >= 'a' ? ch - 'a' + 'A' : ch);
     }
 
     std::array<char_t, max_prefix_size> prefix_buffer;
@@ -339,9 +351,7 @@ inline void write_unsigned_integer(std::basic_ostream<char_t, traits_t>& stream,
             prefix_buffer[prefix_size++] = sign_prefix[idx];
     }
 
-    const char_t* digits = digits_out;
-    const uint_t digit_size = static_cast<uint_t>(digits_buffer.data() + digits_buffer.size() - digits);
-    const bool is_zero = digit_size == 1 && digits[0] == char_t('0');
+    const bool is_zero = magnitude == 0;
 
     if ((stream.flags() & std::ios::showbase) != 0 && !is_zero) {
 
@@ -351,10 +361,15 @@ inline void write_unsigned_integer(std::basic_ostream<char_t, traits_t>& stream,
 
             prefix_buffer[prefix_size++] = char_t('0');
             prefix_buffer[prefix_size++] = uppercase ? char_t('X') : char_t('x');
+
+        } else if (base == 2) {
+
+            prefix_buffer[prefix_size++] = char_t('0');
+            prefix_buffer[prefix_size++] = uppercase ? char_t('B') : char_t('b');
         }
     }
 
-    write_formatted(stream, prefix_buffer.data(), prefix_size, digits, digit_size);
+    write_formatted<max_chars>(stream, prefix_buffer.data(), prefix_size, digits, digit_size);
 }
 
 
@@ -363,7 +378,8 @@ inline void write_unsigned_integer(std::basic_ostream<char_t, traits_t>& stream,
 template<typename long_uint_t, typename char_t, class traits_t>
 inline std::optional<long_uint_t> read_unsigned_integer(std::basic_istream<char_t, traits_t>& stream)
 {
-    using native_t = typename long_uint_t::native_array_t::value_type;
+    constexpr uint_t max_chars = bit_count_v<long_uint_t>;
+    constexpr auto digits_table = "0123456789abcdef";
 
     // use the standard formatted-input guard to honor stream state and skipws
 
@@ -393,59 +409,86 @@ inline std::optional<long_uint_t> read_unsigned_integer(std::basic_istream<char_
         buffer->sbumpc();
     }
 
-    const uint_t base = get_base(stream.flags());
-    const chunk_traits_t<native_t> traits = get_chunk_traits<native_t>(base);
-    const native_t native_base = static_cast<native_t>(base);
+    const uint_t base = get_base(stream);
 
-    long_uint_t value = 0;
+    std::array<char, max_chars> chars;
+    uint_t char_count = 0;
     bool has_digits = false;
-    native_t chunk = 0;
-    uint_t digit_count = 0;
+    bool overflow = false;
 
-    // accumulate input digits into native chunks and flush them into the wide value
+    // collect significant digits for from_chars, a value longer than the binary width cannot fit
 
-    while (true) {
+    const auto collect_digit = [&](uint_t digit) {
 
-        const typename traits_t::int_type digit_char = buffer->sgetc();
+        has_digits = true;
 
-        if (digit_char == traits_t::eof()) {
+        if (char_count == 0 && digit == 0)
+            return;
 
-            stream.setstate(std::ios::eofbit);
-            break;
-        }
+        if (char_count < max_chars)
+            chars[char_count++] = digits_table[digit];
+        else
+            overflow = true;
+    };
 
-        const char_t digit_source = std::char_traits<char_t>::to_char_type(digit_char);
-        const std::optional<uint_t> digit = parse_digit(digit_source, base);
+    bool scanning = true;
 
-        if (!digit.has_value())
-            break;
+    while (scanning) {
 
-        has_digits = true;
-        const native_t digit_value = static_cast<native_t>(*digit);
+        const char_t* const first = get_area_access<char_t, traits_t>::begin(*buffer);
+        const char_t* const last = get_area_access<char_t, traits_t>::end(*buffer);
 
-        if (digit_count == traits.digits_per_chunk || chunk > (std::numeric_limits<native_t>::max() - digit_value) / native_base) {
+        if (first == last) {
 
-            if (!append_chunk(value, base, chunk, digit_count)) {
+            // empty get area is refilled by sgetc, unbuffered streams are read character by character
 
-                stream.setstate(std::ios::failbit);
-                return std::nullopt;
+            const typename traits_t::int_type digit_char = buffer->sgetc();
+
+            if (digit_char == traits_t::eof()) {
+
+                stream.setstate(std::ios::eofbit);
+                break;
             }
 
-            chunk = digit_value;
-            digit_count = 1;
-            buffer->sbumpc();
+            if (get_area_access<char_t, traits_t>::begin(*buffer) != get_area_access<char_t, traits_t>::end(*buffer))
+                continue;
+
+            const std::optional<uint_t> digit = parse_digit(traits_t::to_char_type(digit_char), base);
 
+            if (!digit.has_value())
+                break;
+
+            collect_digit(*digit);
+            buffer->sbumpc();
             continue;
         }
 
-        chunk = chunk * native_base + digit_value;
-        ++digit_count;
-        buffer->sbumpc();
+        // parse directly from the buffered characters
+
+        const char_t* ptr = first;
+
+        for (; ptr != last; ++ptr) {
+
+            const std::optional<uint_t> digit = parse_digit(*ptr, base);
+
+            if (!digit.has_value()) {
+
+                scanning = false;
+                break;
+            }
+
+            collect_digit(*digit);
+        }
+
+        get_area_access<char_t, traits_t>::consume(*buffer, ptr - first);
     }
 
-    // flush the trailing chunk and apply the parsed sign at the very end
+    long_uint_t value = 0;
+
+    if (char_count > 0 && !overflow)
+        overflow = from_chars(chars.data(), chars.data() + char_count, value, static_cast<int>(base)).ec != std::errc();
 
-    if (!append_chunk(value, base, chunk, digit_count) || !has_digits) {
+    if (!has_digits || overflow) {
 
         stream.setstate(std::ios::failbit);
         return std::nullopt;
@@ -460,9 +503,12 @@ inline std::optional<long_uint_t> read_unsigned_integer(std::basic_istream<char_
 
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
-template<typename char_t, class traits_t>
+template<uint_t max_digit_size, typename char_t, class traits_t>
 inline void write_formatted(std::basic_ostream<char_t, traits_t>& stream, const char_t* prefix, uint_t prefix_size, const char_t* digits, uint_t digit_size)
 {
+    constexpr uint_t max_prefix_size = 3;
+    constexpr uint_t fill_chunk_size = 64;
+
     const std::streamsize width = stream.width(0);
     const std::streamsize total_size = static_cast<std::streamsize>(prefix_size + digit_size);
     const std::streamsize fill_size = std::max<std::streamsize>(0, width - total_size);
@@ -484,20 +530,56 @@ inline void write_formatted(std::basic_ostream<char_t, traits_t>& stream, const
             leading_fill_size = fill_size;
     }
 
-    for (std::streamsize idx = 0; idx < leading_fill_size; ++idx)
-        stream.put(fill);
+    std::basic_streambuf<char_t, traits_t>* const buffer = stream.rdbuf();
+    std::array<char_t, max_prefix_size + max_digit_size + fill_chunk_size> output;
+    bool written = true;
+
+    if (fill_size <= static_cast<std::streamsize>(fill_chunk_size)) {
+
+        // compose the whole output including fill locally and hand it to the stream buffer at once
+
+        char_t* out = output.data();
+
+        out = std::fill_n(out, leading_fill_size, fill);
+        out = std::copy_n(prefix, prefix_size, out);
+        out = std::fill_n(out, middle_fill_size, fill);
+        out = std::copy_n(digits, digit_size, out);
+        out = std::fill_n(out, trailing_fill_size, fill);
+
+        const std::streamsize output_size = out - output.data();
+
+        written = buffer->sputn(output.data(), output_size) == output_size;
+
+    } else {
+
+        // very wide fill is written in chunks
+
+        std::fill_n(output.data(), fill_chunk_size, fill);
+
+        const auto write_fill = [&](std::streamsize count) {
 
-    if (prefix_size > 0)
-        stream.write(prefix, static_cast<std::streamsize>(prefix_size));
+            for (; count > 0 && written; count -= fill_chunk_size) {
 
-    for (std::streamsize idx = 0; idx < middle_fill_size; ++idx)
-        stream.put(fill);
+                const std::streamsize chunk_size = std::min<std::streamsize>(count, fill_chunk_size);
+                written = buffer->sputn(output.data(), chunk_size) == chunk_size;
+            }
+        };
+
+        const auto write_chars = [&](const char_t* chars, uint_t count) {
 
-    if (digit_size > 0)
-        stream.write(digits, static_cast<std::streamsize>(digit_size));
+            if (written)
+                written = buffer->sputn(chars, static_cast<std::streamsize>(count)) == static_cast<std::streamsize>(count);
+        };
+
+        write_fill(leading_fill_size);
+        write_chars(prefix, prefix_size);
+        write_fill(middle_fill_size);
+        write_chars(digits, digit_size);
+        write_fill(trailing_fill_size);
+    }
 
-    for (std::streamsize idx = 0; idx < trailing_fill_size; ++idx)
-        stream.put(fill);
+    if (!written)
+        stream.setstate(std::ios::badbit);
 }
 
 } // namespace impl
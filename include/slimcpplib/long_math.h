@@ -37,6 +37,8 @@
 #include <cstdint>
 
 #include <array>
+#include <bit>
+#include <compare>
 #include <limits>
 #include <optional>
 #include <type_traits>
@@ -34,7 +34,9 @@
 
 #include "long_math.h"
 
+#include <bit>
 #include <functional>
+#include <span>
 
 #if __has_include("long_math_gcc.h")
 #include "long_math_gcc.h"
@@ -55,6 +57,22 @@ class long_uint_t;
 template<typename type_t, uint_t size>
 class long_int_t;
 
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// hash routines
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+// hash of integer: pairs of 64-bit words, each xored with its own constant, are folded by
+// multiplication, xor of low and high halves of the 128-bit product depends on all bits of both
+// words; products of pairs are independent and combined by rotations and additions, the result is
+// folded once more; signed integers hash as their unsigned bit representation
+
+template<typename type_t, uint_t size>
+constexpr size_t hash(const long_uint_t<type_t, size>& value) noexcept;
+template<typename type_t, uint_t size>
+constexpr size_t hash(const long_int_t<type_t, size>& value) noexcept;
+
 } // namespace slim
 
 namespace std
@@ -236,27 +254,9 @@ struct hash<slim::long_uint_t<type_t, size>> {
 public:
     using long_uint_t = slim::long_uint_t<type_t, size>;
 
-    static constexpr size_t combine_hash(size_t value1, size_t value2) noexcept
-    {
-        return value1 ^ (value2 + size_t(0x9e3779b9) + (value1 << 6) + (value1 >> 2));
-    }
-
-    static constexpr size_t hash_word(type_t value) noexcept
-    {
-        if constexpr (sizeof(type_t) <= sizeof(size_t))
-            return static_cast<size_t>(value);
-        else
-            return combine_hash(static_cast<size_t>(slim::half_lo(value)), static_cast<size_t>(slim::half_hi(value)));
-    }
-
     constexpr size_t operator()(const long_uint_t& value) const noexcept
     {
-        size_t result = hash_word(value.digits[0]);
-
-        for (slim::uint_t n = 1; n < size; ++n)
-            result = combine_hash(result, hash_word(value.digits[n]));
-
-        return result;
+        return slim::hash(value);
     }
 };
 
@@ -273,7 +273,7 @@ public:
 
     constexpr size_t operator()(const long_int_t& value) const noexcept
     {
-        return hash<long_uint_t>()(static_cast<const long_uint_t&>(value));
+        return slim::hash(value);
     }
 };
 
@@ -326,6 +326,15 @@ struct half_type<long_uint_t<type_t, 2>> {
 
 
 
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// is_long_integer_v
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+template<typename type_t>
+constexpr bool is_long_integer_v = is_integer_v<type_t> && !std::is_integral_v<type_t>;
+
+
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 // standalone routines
 ////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -387,21 +396,64 @@ constexpr long_uint_t<type_t, size> divqr(const long_uint_t<type_t, size>& value
 template<typename type_t, std::enable_if_t<is_unsigned_array_v<type_t>, int> = 0>
 constexpr void negate(type_t& value) noexcept;
 
-// add two vectors
+// add two vectors, returning carry
 
 template<typename type_t, std::enable_if_t<is_unsigned_array_v<type_t>, int> = 0>
-constexpr void add(type_t& value1, const type_t& value2) noexcept;
+constexpr bool add(type_t& value1, const type_t& value2) noexcept;
 
-// subtract two vectors
+// subtract two vectors, returning borrow
 
 template<typename type_t, std::enable_if_t<is_unsigned_array_v<type_t>, int> = 0>
-constexpr void sub(type_t& value1, const type_t& value2) noexcept;
+constexpr bool sub(type_t& value1, const type_t& value2) noexcept;
 
 // multiply two vectors
 
 template<typename value_t, std::enable_if_t<is_unsigned_array_v<value_t>, int> = 0>
 constexpr value_t mul(value_t& value1, const value_t& value2) noexcept;
 
+// add shorter vector to longer one, propagating only carry through the upper digits
+
+template<typename native_t, uint_t size, uint_t other_size, std::enable_if_t<is_unsigned_v<native_t> && (other_size < size), int> = 0>
+constexpr bool add(std::array<native_t, size>& value1, const std::array<native_t, other_size>& value2) noexcept;
+
+// subtract shorter vector from longer one, propagating only borrow through the upper digits
+
+template<typename native_t, uint_t size, uint_t other_size, std::enable_if_t<is_unsigned_v<native_t> && (other_size < size), int> = 0>
+constexpr bool sub(std::array<native_t, size>& value1, const std::array<native_t, other_size>& value2) noexcept;
+
+// multiply vector by the same or shorter one and add third vector, keeping only the lower digits of result
+
+template<typename native_t, uint_t size, uint_t other_size, std::enable_if_t<is_unsigned_v<native_t> && (other_size <= size), int> = 0>
+constexpr void mul_add(std::array<native_t, size>& value1, const std::array<native_t, other_size>& value2, const std::array<native_t, size>& addend) noexcept;
+
+// multiply vector by shorter one, keeping only the lower digits of product
+
+template<typename native_t, uint_t size, uint_t other_size, std::enable_if_t<is_unsigned_v<native_t> && (other_size < size), int> = 0>
+constexpr void mul(std::array<native_t, size>& value1, const std::array<native_t, other_size>& value2) noexcept;
+
+// hash of every integer, a convenience wrapper of hash() loop: products of neighbouring integers
+// don't depend on each other, so that iterations overlap without explicit interleaving
+
+template<typename type_t, std::enable_if_t<is_long_integer_v<type_t>, int> = 0>
+constexpr void hash_n(std::span<const type_t> values, std::span<size_t> hashes) noexcept;
+
+namespace impl
+{
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// standalone helper methods
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+// fold two words into one with xor of halves of their product
+
+constexpr uint64_t hash_fold(uint64_t value1, uint64_t value2) noexcept;
+
+// 64-bit word of integer built from its digits
+
+template<typename type_t, uint_t size>
+constexpr uint64_t hash_word(const long_uint_t<type_t, size>& value, uint_t index) noexcept;
+
+} // namespace impl
+
 
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -686,24 +738,28 @@ constexpr void negate(type_t& value) noexcept
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 template<typename type_t, std::enable_if_t<is_unsigned_array_v<type_t>, int>>
-constexpr void add(type_t& value1, const type_t& value2) noexcept
+constexpr bool add(type_t& value1, const type_t& value2) noexcept
 {
     bool carry = add(value1[0], value2[0]);
 
     for (uint_t n = 1; n < std::size(value1); ++n)
         carry = addc(value1[n], value2[n], carry);
+
+    return carry;
 }
 
 
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 template<typename type_t, std::enable_if_t<is_unsigned_array_v<type_t>, int>>
-constexpr void sub(type_t& value1, const type_t& value2) noexcept
+constexpr bool sub(type_t& value1, const type_t& value2) noexcept
 {
     bool borrow = sub(value1[0], value2[0]);
 
     for (uint_t n = 1; n < std::size(value1); ++n)
         borrow = subb(value1[n], value2[n], borrow);
+
+    return borrow;
 }
 
 
@@ -744,6 +800,172 @@ constexpr value_t mul(value_t& value1, const value_t& value2) noexcept
     return carry;
 }
 
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+template<typename native_t, uint_t size, uint_t other_size, std::enable_if_t<is_unsigned_v<native_t> && (other_size < size), int>>
+constexpr bool add(std::array<native_t, size>& value1, const std::array<native_t, other_size>& value2) noexcept
+{
+    bool carry = add(value1[0], value2[0]);
+
+    for (uint_t n = 1; n < other_size; ++n)
+        carry = addc(value1[n], value2[n], carry);
+    for (uint_t n = other_size; carry && n < size; ++n)
+        carry = add(value1[n], native_t(1));
+
+    return carry;
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+template<typename native_t, uint_t size, uint_t other_size, std::enable_if_t<is_unsigned_v<native_t> && (other_size < size), int>>
+constexpr bool sub(std::array<native_t, size>& value1, const std::array<native_t, other_size>& value2) noexcept
+{
+    bool borrow = sub(value1[0], value2[0]);
+
+    for (uint_t n = 1; n < other_size; ++n)
+        borrow = subb(value1[n], value2[n], borrow);
+    for (uint_t n = other_size; borrow && n < size; ++n)
+        borrow = sub(value1[n], native_t(1));
+
+    return borrow;
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+template<typename native_t, uint_t size, uint_t other_size, std::enable_if_t<is_unsigned_v<native_t> && (other_size <= size), int>>
+constexpr void mul_add(std::array<native_t, size>& value1, const std::array<native_t, other_size>& value2, const std::array<native_t, size>& addend) noexcept
+{
+    std::array<native_t, size> result = addend;
+
+    for (uint_t value2_idx = 0; value2_idx < other_size; ++value2_idx) {
+
+        // zero digits do not contribute to the product
+
+        if (value2[value2_idx] == 0)
+            continue;
+
+        native_t carry = 0;
+
+        for (uint_t value1_idx = 0; value1_idx + value2_idx < size; ++value1_idx) {
+
+            const uint_t result_idx = value1_idx + value2_idx;
+
+            // product plus two digits always fits into two digits
+
+            native_t product_lo = value1[value1_idx];
+            native_t product_hi = mulc(product_lo, value2[value2_idx], carry);
+
+            product_hi += add(result[result_idx], product_lo);
+            carry = product_hi;
+        }
+    }
+
+    value1 = result;
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+template<typename native_t, uint_t size, uint_t other_size, std::enable_if_t<is_unsigned_v<native_t> && (other_size < size), int>>
+constexpr void mul(std::array<native_t, size>& value1, const std::array<native_t, other_size>& value2) noexcept
+{
+    mul_add(value1, value2, std::array<native_t, size>{});
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+template<typename type_t, std::enable_if_t<is_long_integer_v<type_t>, int>>
+constexpr void hash_n(std::span<const type_t> values, std::span<size_t> hashes) noexcept
+{
+    assert(hashes.size() >= values.size());
+
+    for (size_t n = 0; n < values.size(); ++n)
+        hashes[n] = hash(values[n]);
+}
+
+
+
+namespace impl
+{
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// standalone helper methods
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+constexpr uint64_t hash_fold(uint64_t value1, uint64_t value2) noexcept
+{
+    const uint64_t hi = mul(value1, value2);
+
+    return value1 ^ hi;
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+template<typename type_t, uint_t size>
+constexpr uint64_t hash_word(const long_uint_t<type_t, size>& value, uint_t index) noexcept
+{
+    static_assert(byte_count_v<type_t> <= byte_count_v<uint64_t>, "hash requires digits not wider than 64 bits");
+
+    constexpr uint_t digits_per_word = byte_count_v<uint64_t> / byte_count_v<type_t>;
+
+    uint64_t word = 0;
+
+    for (uint_t n = 0; n < digits_per_word && index * digits_per_word + n < size; ++n)
+        word |= static_cast<uint64_t>(value.digits[index * digits_per_word + n]) << (n * bit_count_v<type_t> % bit_count_v<uint64_t>);
+
+    return word;
+}
+
+} // namespace impl
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// hash routines
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+template<typename type_t, uint_t size>
+constexpr size_t hash(const long_uint_t<type_t, size>& value) noexcept
+{
+    // odd constants with balanced bits, as in wyhash
+
+    constexpr uint64_t seed = 0xa0761d6478bd642full;
+    constexpr uint64_t key1 = 0xe7037ed1a0b428dbull;
+    constexpr uint64_t key2 = 0x8ebc6af09c88c6e3ull;
+    constexpr uint_t word_count = (size * byte_count_v<type_t> + byte_count_v<uint64_t> - 1) / byte_count_v<uint64_t>;
+
+    // factors are added to the product of every pair, so that a factor equal to zero doesn't erase
+    // the other word; rotation of state between pairs makes their order matter without a chain of
+    // multiplications
+
+    uint64_t state = 0;
+    uint64_t offset = seed;
+
+    for (uint_t n = 0; n < word_count; n += 2) {
+
+        const uint64_t factor1 = impl::hash_word(value, n) ^ offset;
+        const uint64_t factor2 = (n + 1 < word_count ? impl::hash_word(value, n + 1) : 0) ^ (offset + key1);
+
+        state = std::rotl(state, 23) + impl::hash_fold(factor1, factor2) + factor1 + std::rotl(factor2, 32);
+        offset += key1 << 1;
+    }
+
+    return static_cast<size_t>(impl::hash_fold(state ^ key1 ^ (size * byte_count_v<type_t>), key2));
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+template<typename type_t, uint_t size>
+constexpr size_t hash(const long_int_t<type_t, size>& value) noexcept
+{
+    return hash(static_cast<const long_uint_t<type_t, size>&>(value));
+}
+
 } // namespace slim
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
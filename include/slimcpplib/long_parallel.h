@@ -0,0 +1,514 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// Simple Long Integer Math for C++
+// version 2.0
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// Licensed under the MIT License <http://opensource.org/licenses/MIT>.
+// SPDX-License-Identifier: MIT
+//
+// Copyright (c) 2020-2026 Yury Kalmykov <y_kalmykov@mail.ru>.
+//
+// Permission is hereby  granted, free of charge, to any  person obtaining a copy
+// of this software and associated  documentation files (the "Software"), to deal
+// in the Software  without restriction, including without  limitation the rights
+// to  use, copy,  modify, merge,  publish, distribute,  sublicense, and/or  sell
+// copies  of  the Software,  and  to  permit persons  to  whom  the Software  is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE  IS PROVIDED "AS  IS", WITHOUT WARRANTY  OF ANY KIND,  EXPRESS OR
+// IMPLIED,  INCLUDING BUT  NOT  LIMITED TO  THE  WARRANTIES OF  MERCHANTABILITY,
+// FITNESS FOR  A PARTICULAR PURPOSE AND  NONINFRINGEMENT. IN NO EVENT  SHALL THE
+// AUTHORS  OR COPYRIGHT  HOLDERS  BE  LIABLE FOR  ANY  CLAIM,  DAMAGES OR  OTHER
+// LIABILITY, WHETHER IN AN ACTION OF  CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE  OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+
+#pragma once
+
+#include "long_accumulator.h"
+#include "long_sort.h"
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <condition_variable>
+#include <limits>
+#include <mutex>
+#include <span>
+#include <thread>
+#include <vector>
+
+namespace slim
+{
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// thread_pool class
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+// fixed set of worker threads that execute indexed tasks: the calling thread takes part in every
+// run, tasks are handed out by an atomic counter, the mutex is taken only to start and finish runs
+
+class thread_pool
+{
+public:
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    // construction/destruction
+
+    explicit thread_pool(uint_t thread_count = hardware_threads());
+    ~thread_pool() noexcept;
+
+    thread_pool(const thread_pool&) = delete;
+    thread_pool& operator=(const thread_pool&) = delete;
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    // public methods
+
+    // number of threads including the calling one
+    uint_t size() const noexcept;
+
+    // call task(index) for every index in [0, task_count) and wait for completion, runs from
+    // different threads are serialized
+    template<typename task_t>
+    void run(uint_t task_count, const task_t& task) noexcept;
+
+    static uint_t hardware_threads() noexcept;
+
+private:
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    // type definitions
+
+    using invoke_t = void (*)(const void* task, uint_t index) noexcept;
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    // private methods
+
+    void work() noexcept;
+    void execute() noexcept;
+
+private:
+    std::vector<std::thread> threads;
+    std::mutex run_mutex;
+    std::mutex mutex;
+    std::condition_variable started;
+    std::condition_variable finished;
+    invoke_t invoke = nullptr;
+    const void* context = nullptr;
+    uint_t tasks = 0;
+    std::atomic<uint_t> next_index = 0;
+    uint_t busy_threads = 0;
+    uint64_t generation = 0;
+    bool stopping = false;
+};
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// standalone methods
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+// sort integers in ascending order with radix sort on all threads of the pool: every thread counts
+// and scatters its own part of the input with its own histograms, only offsets of buckets are
+// combined between passes; the result is the same as of radix_sort()
+
+template<typename type_t, std::enable_if_t<is_long_integer_v<type_t>, int> = 0>
+void parallel_radix_sort(thread_pool& pool, std::span<type_t> values);
+template<typename type_t, std::enable_if_t<is_long_integer_v<type_t>, int> = 0>
+void parallel_radix_sort(thread_pool& pool, std::span<type_t> values, std::span<type_t> buffer);
+
+// sum of integers modulo 2^bit_count_v<type_t> on all threads of the pool: every thread adds
+// digits into separate columns with deferred carries, partial sums are combined at the end
+
+template<typename type_t, std::enable_if_t<is_long_integer_v<type_t>, int> = 0>
+type_t parallel_reduce(thread_pool& pool, std::span<const type_t> values);
+
+// exact sum of products on all threads of the pool: every thread computes dot_exact() of its part,
+// partial sums are exact, so the result is the same for any number of threads
+
+template<typename type_t = int256_t, std::enable_if_t<is_long_integer_v<type_t>, int> = 0>
+type_t parallel_dot_exact(thread_pool& pool, std::span<const typename accumulator<type_t>::value_type> values1, std::span<const typename accumulator<type_t>::value_type> values2);
+
+namespace impl
+{
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// constants
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+// smaller parts are processed by fewer threads, as synchronization costs more than the work
+constexpr size_t parallel_min_part = 4096;
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// standalone helper methods
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+uint_t parallel_task_count(const thread_pool& pool, size_t count) noexcept;
+template<typename type_t>
+std::span<type_t> parallel_part(std::span<type_t> values, uint_t index, uint_t task_count) noexcept;
+template<typename type_t>
+type_t deferred_carry_sum(std::span<const type_t> values) noexcept;
+
+} // namespace impl
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// thread_pool class
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+inline thread_pool::thread_pool(uint_t thread_count)
+{
+    for (uint_t n = 1; n < thread_count; ++n)
+        threads.emplace_back([this]() noexcept { work(); });
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+inline thread_pool::~thread_pool() noexcept
+{
+    {
+        const std::lock_guard<std::mutex> lock(mutex);
+        stopping = true;
+    }
+
+    started.notify_all();
+
+    for (std::thread& thread : threads)
+        thread.join();
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+inline uint_t thread_pool::size() const noexcept
+{
+    return threads.size() + 1;
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+template<typename task_t>
+inline void thread_pool::run(uint_t task_count, const task_t& task) noexcept
+{
+    if (threads.empty() || task_count < 2) {
+
+        for (uint_t index = 0; index < task_count; ++index)
+            task(index);
+
+        return;
+    }
+
+    const std::lock_guard<std::mutex> run_lock(run_mutex);
+
+    {
+        const std::lock_guard<std::mutex> lock(mutex);
+
+        invoke = [](const void* function, uint_t index) noexcept { (*static_cast<const task_t*>(function))(index); };
+        context = &task;
+        tasks = task_count;
+        next_index.store(0, std::memory_order_relaxed);
+        busy_threads = threads.size();
+        ++generation;
+    }
+
+    started.notify_all();
+    execute();
+
+    std::unique_lock<std::mutex> lock(mutex);
+    finished.wait(lock, [this]() noexcept { return busy_threads == 0; });
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+inline uint_t thread_pool::hardware_threads() noexcept
+{
+    return std::max(std::thread::hardware_concurrency(), 1u);
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+inline void thread_pool::work() noexcept
+{
+    uint64_t finished_generation = 0;
+
+    for (;;) {
+
+        {
+            std::unique_lock<std::mutex> lock(mutex);
+            started.wait(lock, [&]() noexcept { return stopping || generation != finished_generation; });
+
+            if (stopping)
+                return;
+
+            finished_generation = generation;
+        }
+
+        execute();
+
+        {
+            const std::lock_guard<std::mutex> lock(mutex);
+
+            if (--busy_threads == 0)
+                finished.notify_one();
+        }
+    }
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+inline void thread_pool::execute() noexcept
+{
+    for (uint_t index = next_index.fetch_add(1, std::memory_order_relaxed); index < tasks; index = next_index.fetch_add(1, std::memory_order_relaxed))
+        invoke(context, index);
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// standalone methods
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+template<typename type_t, std::enable_if_t<is_long_integer_v<type_t>, int>>
+inline void parallel_radix_sort(thread_pool& pool, std::span<type_t> values)
+{
+    std::vector<type_t> buffer(values.size());
+
+    parallel_radix_sort(pool, values, std::span<type_t>(buffer));
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+template<typename type_t, std::enable_if_t<is_long_integer_v<type_t>, int>>
+inline void parallel_radix_sort(thread_pool& pool, std::span<type_t> values, std::span<type_t> buffer)
+{
+    assert(buffer.size() >= values.size());
+
+    const uint_t task_count = impl::parallel_task_count(pool, values.size());
+
+    if (task_count < 2) {
+
+        radix_sort(values, buffer);
+        return;
+    }
+
+    // histograms of all passes tell which passes are needed, they don't depend on the order
+
+    std::vector<impl::radix_histograms_t<type_t>> histograms(task_count);
+
+    pool.run(task_count, [&](uint_t task) noexcept {
+        impl::radix_histograms(std::span<const type_t>(impl::parallel_part(values, task, task_count)), histograms[task]);
+    });
+
+    impl::radix_histograms_t<type_t> totals = histograms.front();
+
+    for (uint_t task = 1; task < task_count; ++task) {
+
+        for (uint_t index = 0; index < byte_count_v<type_t>; ++index) {
+
+            for (uint_t bucket = 0; bucket < impl::radix_size; ++bucket)
+                totals[index][bucket] += histograms[task][index][bucket];
+        }
+    }
+
+    std::span<type_t> source = values;
+    std::span<type_t> target = buffer.first(values.size());
+    std::vector<std::array<size_t, impl::radix_size>> offsets(task_count);
+    bool first_pass = true;
+
+    for (uint_t index = 0; index < byte_count_v<type_t>; ++index) {
+
+        if (!impl::radix_pass_needed(totals[index], values.size()))
+            continue;
+
+        // parts are reordered by previous passes, so their histograms are counted again
+
+        if (first_pass) {
+
+            for (uint_t task = 0; task < task_count; ++task)
+                offsets[task] = histograms[task][index];
+
+        } else {
+
+            pool.run(task_count, [&](uint_t task) noexcept {
+
+                offsets[task].fill(0);
+
+                for (const type_t& value : impl::parallel_part(source, task, task_count))
+                    ++offsets[task][impl::radix_byte(value, index)];
+            });
+        }
+
+        // part of every thread starts in a bucket after parts of preceding threads
+
+        size_t offset = 0;
+
+        for (uint_t bucket = 0; bucket < impl::radix_size; ++bucket) {
+
+            for (uint_t task = 0; task < task_count; ++task) {
+
+                const size_t count = offsets[task][bucket];
+
+                offsets[task][bucket] = offset;
+                offset += count;
+            }
+        }
+
+        pool.run(task_count, [&](uint_t task) noexcept {
+
+            for (const type_t& value : impl::parallel_part(source, task, task_count))
+                target[offsets[task][impl::radix_byte(value, index)]++] = value;
+        });
+
+        std::swap(source, target);
+        first_pass = false;
+    }
+
+    if (source.data() != values.data()) {
+
+        pool.run(task_count, [&](uint_t task) noexcept {
+
+            const std::span<type_t> part = impl::parallel_part(source, task, task_count);
+            std::copy(part.begin(), part.end(), values.begin() + (part.data() - source.data()));
+        });
+    }
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+template<typename type_t, std::enable_if_t<is_long_integer_v<type_t>, int>>
+inline type_t parallel_reduce(thread_pool& pool, std::span<const type_t> values)
+{
+    const uint_t task_count = impl::parallel_task_count(pool, values.size());
+
+    if (task_count < 2)
+        return impl::deferred_carry_sum(values);
+
+    // partial sums are written once per thread, so sharing of cache lines doesn't matter
+
+    std::vector<type_t> sums(task_count);
+
+    pool.run(task_count, [&](uint_t task) noexcept {
+        sums[task] = impl::deferred_carry_sum(impl::parallel_part(values, task, task_count));
+    });
+
+    type_t result = 0;
+
+    for (const type_t& sum : sums)
+        result += sum;
+
+    return result;
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+template<typename type_t, std::enable_if_t<is_long_integer_v<type_t>, int>>
+inline type_t parallel_dot_exact(thread_pool& pool, std::span<const typename accumulator<type_t>::value_type> values1, std::span<const typename accumulator<type_t>::value_type> values2)
+{
+    assert(values1.size() == values2.size());
+
+    const uint_t task_count = impl::parallel_task_count(pool, values1.size());
+
+    if (task_count < 2)
+        return dot_exact<type_t>(values1, values2);
+
+    std::vector<type_t> sums(task_count);
+
+    pool.run(task_count, [&](uint_t task) noexcept {
+        sums[task] = dot_exact<type_t>(impl::parallel_part(values1, task, task_count), impl::parallel_part(values2, task, task_count));
+    });
+
+    type_t result = 0;
+
+    for (const type_t& sum : sums)
+        result += sum;
+
+    return result;
+}
+
+
+
+namespace impl
+{
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// standalone helper methods
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+inline uint_t parallel_task_count(const thread_pool& pool, size_t count) noexcept
+{
+    return static_cast<uint_t>(std::min<size_t>(pool.size(), std::max<size_t>(count / parallel_min_part, 1)));
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+template<typename type_t>
+inline std::span<type_t> parallel_part(std::span<type_t> values, uint_t index, uint_t task_count) noexcept
+{
+    const size_t first = values.size() * index / task_count;
+    const size_t last = values.size() * (index + 1) / task_count;
+
+    return values.subspan(first, last - first);
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+template<typename type_t>
+inline type_t deferred_carry_sum(std::span<const type_t> values) noexcept
+{
+    using native_t = typename type_t::native_array_t::value_type;
+    using native_array_t = typename type_t::native_array_t;
+
+    // digits are added into independent columns without a carry chain, carries out of every
+    // column are counted and added to the next column once per block, before counters overflow
+
+    constexpr size_t block_size = std::numeric_limits<native_t>::max();
+
+    type_t result = 0;
+
+    for (size_t first = 0; first < values.size(); first += block_size) {
+
+        const std::span<const type_t> block = values.subspan(first, std::min(block_size, values.size() - first));
+
+        native_array_t columns{};
+        native_array_t carries{};
+
+        for (const type_t& value : block) {
+
+            for (uint_t n = 0; n < columns.size(); ++n) {
+
+                columns[n] += value.digits[n];
+                carries[n] += columns[n] < value.digits[n];
+            }
+        }
+
+        type_t carry(carries);
+        carry <<= bit_count_v<native_t>;
+
+        result += type_t(columns);
+        result += carry;
+    }
+
+    return result;
+}
+
+} // namespace impl
+} // namespace slim
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// End of long_parallel.h
+////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,671 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// Simple Long Integer Math for C++
+// version 2.0
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// Licensed under the MIT License <http://opensource.org/licenses/MIT>.
+// SPDX-License-Identifier: MIT
+//
+// Copyright (c) 2020-2026 Yury Kalmykov <y_kalmykov@mail.ru>.
+//
+// Permission is hereby  granted, free of charge, to any  person obtaining a copy
+// of this software and associated  documentation files (the "Software"), to deal
+// in the Software  without restriction, including without  limitation the rights
+// to  use, copy,  modify, merge,  publish, distribute,  sublicense, and/or  sell
+// copies  of  the Software,  and  to  permit persons  to  whom  the Software  is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE  IS PROVIDED "AS  IS", WITHOUT WARRANTY  OF ANY KIND,  EXPRESS OR
+// IMPLIED,  INCLUDING BUT  NOT  LIMITED TO  THE  WARRANTIES OF  MERCHANTABILITY,
+// FITNESS FOR  A PARTICULAR PURPOSE AND  NONINFRINGEMENT. IN NO EVENT  SHALL THE
+// AUTHORS  OR COPYRIGHT  HOLDERS  BE  LIABLE FOR  ANY  CLAIM,  DAMAGES OR  OTHER
+// LIABILITY, WHETHER IN AN ACTION OF  CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE  OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+
+#pragma once
+
+#include "long_cpu.h"
+#include "long_int.h"
+#include "long_uint.h"
+
+#include <algorithm>
+#include <span>
+
+#if defined(__GNUC__) && defined(__x86_64__)
+#include <immintrin.h>
+#endif
+
+namespace slim
+{
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// type definitions
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+template<typename type_t>
+using array_kernel_t = void (*)(std::span<type_t> result, std::span<const type_t> values1, std::span<const type_t> values2) noexcept;
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// standalone methods
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+// add and subtract arrays of integers element by element with wraparound, sizes of operands must
+// be equal to size of result, result may be the same array as one of operands; kernels are bound
+// once per type for the level returned by isa(), elements that don't fill vectors are processed
+// with scalar code
+
+template<typename type_t, std::enable_if_t<is_long_integer_v<type_t>, int> = 0>
+void add_n(std::span<type_t> result, std::span<const type_t> values1, std::span<const type_t> values2) noexcept;
+template<typename type_t, std::enable_if_t<is_long_integer_v<type_t>, int> = 0>
+void sub_n(std::span<type_t> result, std::span<const type_t> values1, std::span<const type_t> values2) noexcept;
+
+// multiply arrays of integers element by element with wraparound, 256-bit integers with 64-bit
+// digits are multiplied eight at a time in radix 2^52 if the processor supports AVX-512 IFMA
+
+template<typename type_t, std::enable_if_t<is_long_integer_v<type_t>, int> = 0>
+void mul_n(std::span<type_t> result, std::span<const type_t> values1, std::span<const type_t> values2) noexcept;
+
+namespace impl
+{
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// constants and types
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+// 256-bit integer in radix 2^52: five digits of 52 bits in 64-bit words, the upper 12 bits are
+// room for accumulation of partial products
+
+constexpr uint_t radix52_bits = 52;
+constexpr uint64_t radix52_mask = (uint64_t(1) << radix52_bits) - 1;
+constexpr uint_t radix52_size = 5;
+
+using radix52_array_t = std::array<uint64_t, radix52_size>;
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// standalone helper methods
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+// conversion between 64-bit and 52-bit digits and scalar equivalent of the IFMA multiplication
+
+constexpr radix52_array_t to_radix52(const long_uint_t<uint64_t, 4>& value) noexcept;
+constexpr long_uint_t<uint64_t, 4> from_radix52(const radix52_array_t& digits) noexcept;
+constexpr uint64_t madd52lo(uint64_t accumulator, uint64_t value1, uint64_t value2) noexcept;
+constexpr uint64_t madd52hi(uint64_t accumulator, uint64_t value1, uint64_t value2) noexcept;
+constexpr radix52_array_t mul_radix52(const radix52_array_t& digits1, const radix52_array_t& digits2) noexcept;
+
+// kernels of every instruction set level and their selection, vector parts process whole elements
+// only and return number of processed elements
+
+template<typename type_t, isa_t level, bool subtract>
+size_t add_sub_n_vector(type_t* result, const type_t* values1, const type_t* values2, size_t count) noexcept;
+template<typename type_t, isa_t level>
+size_t mul_n_vector(type_t* result, const type_t* values1, const type_t* values2, size_t count) noexcept;
+template<typename type_t, isa_t level>
+void add_n_at(std::span<type_t> result, std::span<const type_t> values1, std::span<const type_t> values2) noexcept;
+template<typename type_t, isa_t level>
+void sub_n_at(std::span<type_t> result, std::span<const type_t> values1, std::span<const type_t> values2) noexcept;
+template<typename type_t, isa_t level>
+void mul_n_at(std::span<type_t> result, std::span<const type_t> values1, std::span<const type_t> values2) noexcept;
+template<typename type_t>
+array_kernel_t<type_t> add_n_kernel(isa_t level) noexcept;
+template<typename type_t>
+array_kernel_t<type_t> sub_n_kernel(isa_t level) noexcept;
+template<typename type_t>
+array_kernel_t<type_t> mul_n_kernel(isa_t level) noexcept;
+
+#if defined(__GNUC__) && defined(__x86_64__)
+
+template<uint_t size, uint_t block>
+constexpr uint64_t element_top_mask() noexcept;
+constexpr uint64_t resolve_carries(uint64_t generate, uint64_t propagate, uint64_t top_mask) noexcept;
+template<uint_t size, bool subtract>
+__attribute__((target("avx2"))) size_t add_sub_n_avx2(uint64_t* result, const uint64_t* values1, const uint64_t* values2, size_t count) noexcept;
+template<uint_t size, bool subtract>
+__attribute__((target("avx512f"))) size_t add_sub_n_avx512(uint64_t* result, const uint64_t* values1, const uint64_t* values2, size_t count) noexcept;
+__attribute__((target("avx512f,avx512ifma"))) size_t mul_n_ifma(uint64_t* result, const uint64_t* values1, const uint64_t* values2, size_t count) noexcept;
+
+#endif // defined(__GNUC__) && defined(__x86_64__)
+
+} // namespace impl
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// standalone methods
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+template<typename type_t, std::enable_if_t<is_long_integer_v<type_t>, int>>
+inline void add_n(std::span<type_t> result, std::span<const type_t> values1, std::span<const type_t> values2) noexcept
+{
+    static const array_kernel_t<type_t> kernel = impl::add_n_kernel<type_t>(isa());
+
+    kernel(result, values1, values2);
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+template<typename type_t, std::enable_if_t<is_long_integer_v<type_t>, int>>
+inline void sub_n(std::span<type_t> result, std::span<const type_t> values1, std::span<const type_t> values2) noexcept
+{
+    static const array_kernel_t<type_t> kernel = impl::sub_n_kernel<type_t>(isa());
+
+    kernel(result, values1, values2);
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+template<typename type_t, std::enable_if_t<is_long_integer_v<type_t>, int>>
+inline void mul_n(std::span<type_t> result, std::span<const type_t> values1, std::span<const type_t> values2) noexcept
+{
+    static const array_kernel_t<type_t> kernel = impl::mul_n_kernel<type_t>(isa());
+
+    kernel(result, values1, values2);
+}
+
+
+
+namespace impl
+{
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// standalone helper methods
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+constexpr radix52_array_t to_radix52(const long_uint_t<uint64_t, 4>& value) noexcept
+{
+    const std::array<uint64_t, 4>& digits = value.digits;
+
+    return {
+        digits[0] & radix52_mask,
+        ((digits[0] >> 52) | (digits[1] << 12)) & radix52_mask,
+        ((digits[1] >> 40) | (digits[2] << 24)) & radix52_mask,
+        ((digits[2] >> 28) | (digits[3] << 36)) & radix52_mask,
+        digits[3] >> 16,
+    };
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+constexpr long_uint_t<uint64_t, 4> from_radix52(const radix52_array_t& digits) noexcept
+{
+    // digits must be normalized, bits above 256 are dropped
+
+    return std::array<uint64_t, 4>{
+        digits[0] | (digits[1] << 52),
+        (digits[1] >> 12) | (digits[2] << 40),
+        (digits[2] >> 24) | (digits[3] << 28),
+        (digits[3] >> 36) | (digits[4] << 16),
+    };
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+constexpr uint64_t madd52lo(uint64_t accumulator, uint64_t value1, uint64_t value2) noexcept
+{
+    // add low 52 bits of the 104-bit product of low 52 bits of operands, as vpmadd52luq does
+
+    uint64_t product_lo = value1 & radix52_mask;
+    mul(product_lo, value2 & radix52_mask);
+
+    return accumulator + (product_lo & radix52_mask);
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+constexpr uint64_t madd52hi(uint64_t accumulator, uint64_t value1, uint64_t value2) noexcept
+{
+    // add high 52 bits of the 104-bit product of low 52 bits of operands, as vpmadd52huq does
+
+    uint64_t product_lo = value1 & radix52_mask;
+    const uint64_t product_hi = mul(product_lo, value2 & radix52_mask);
+
+    return accumulator + ((product_hi << 12) | (product_lo >> 52));
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+constexpr radix52_array_t mul_radix52(const radix52_array_t& digits1, const radix52_array_t& digits2) noexcept
+{
+    // column n collects low halves of products of digits i + j == n and high halves of products of
+    // digits i + j == n - 1, at most nine terms of 52 bits don't overflow 64-bit words; columns
+    // above the fifth hold bits above 256 only and are not computed
+
+    radix52_array_t columns = {};
+
+    for (uint_t n = 0; n < radix52_size; ++n) {
+
+        for (uint_t i = 0; i <= n; ++i)
+            columns[n] = madd52lo(columns[n], digits1[i], digits2[n - i]);
+
+        for (uint_t i = 0; n > 0 && i <= n - 1; ++i)
+            columns[n] = madd52hi(columns[n], digits1[i], digits2[n - 1 - i]);
+    }
+
+    for (uint_t n = 1; n < radix52_size; ++n) {
+
+        columns[n] += columns[n - 1] >> radix52_bits;
+        columns[n - 1] &= radix52_mask;
+    }
+
+    return columns;
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+template<typename type_t, isa_t level, bool subtract>
+inline size_t add_sub_n_vector(type_t* result, const type_t* values1, const type_t* values2, size_t count) noexcept
+{
+#if defined(__GNUC__) && defined(__x86_64__)
+    using native_array_t = typename type_t::native_array_t;
+    using native_t = typename native_array_t::value_type;
+
+    constexpr uint_t size = std::tuple_size_v<native_array_t>;
+
+    // carry masks hold one bit per digit of block, so that longer elements are left to scalar kernel
+
+    if constexpr (std::is_same_v<native_t, uint64_t> && sizeof(type_t) == sizeof(native_array_t) && size <= bit_count_v<uint64_t>) {
+
+        // elements are processed as plain arrays of digits
+
+        uint64_t* result_digits = reinterpret_cast<uint64_t*>(result);
+        const uint64_t* digits1 = reinterpret_cast<const uint64_t*>(values1);
+        const uint64_t* digits2 = reinterpret_cast<const uint64_t*>(values2);
+
+        if constexpr (level >= isa_t::avx512)
+            return add_sub_n_avx512<size, subtract>(result_digits, digits1, digits2, count);
+        else if constexpr (level >= isa_t::avx2)
+            return add_sub_n_avx2<size, subtract>(result_digits, digits1, digits2, count);
+    }
+#else
+    static_cast<void>(result);
+    static_cast<void>(values1);
+    static_cast<void>(values2);
+    static_cast<void>(count);
+#endif // defined(__GNUC__) && defined(__x86_64__)
+
+    return 0;
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+template<typename type_t, isa_t level>
+inline size_t mul_n_vector(type_t* result, const type_t* values1, const type_t* values2, size_t count) noexcept
+{
+#if defined(__GNUC__) && defined(__x86_64__)
+    using native_array_t = typename type_t::native_array_t;
+
+    if constexpr (std::is_same_v<native_array_t, std::array<uint64_t, 4>> && sizeof(type_t) == sizeof(native_array_t)) {
+
+        // low 256 bits of products are the same for signed and unsigned integers
+
+        if constexpr (level >= isa_t::avx512ifma)
+            return mul_n_ifma(reinterpret_cast<uint64_t*>(result), reinterpret_cast<const uint64_t*>(values1), reinterpret_cast<const uint64_t*>(values2), count);
+    }
+#else
+    static_cast<void>(result);
+    static_cast<void>(values1);
+    static_cast<void>(values2);
+    static_cast<void>(count);
+#endif // defined(__GNUC__) && defined(__x86_64__)
+
+    return 0;
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+template<typename type_t, isa_t level>
+inline void add_n_at(std::span<type_t> result, std::span<const type_t> values1, std::span<const type_t> values2) noexcept
+{
+    assert(values1.size() == result.size() && values2.size() == result.size());
+
+    const size_t processed = add_sub_n_vector<type_t, level, false>(result.data(), values1.data(), values2.data(), result.size());
+
+    for (size_t n = processed; n < result.size(); ++n)
+        result[n] = values1[n] + values2[n];
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+template<typename type_t, isa_t level>
+inline void sub_n_at(std::span<type_t> result, std::span<const type_t> values1, std::span<const type_t> values2) noexcept
+{
+    assert(values1.size() == result.size() && values2.size() == result.size());
+
+    const size_t processed = add_sub_n_vector<type_t, level, true>(result.data(), values1.data(), values2.data(), result.size());
+
+    for (size_t n = processed; n < result.size(); ++n)
+        result[n] = values1[n] - values2[n];
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+template<typename type_t, isa_t level>
+inline void mul_n_at(std::span<type_t> result, std::span<const type_t> values1, std::span<const type_t> values2) noexcept
+{
+    assert(values1.size() == result.size() && values2.size() == result.size());
+
+    const size_t processed = mul_n_vector<type_t, level>(result.data(), values1.data(), values2.data(), result.size());
+
+    for (size_t n = processed; n < result.size(); ++n)
+        result[n] = values1[n] * values2[n];
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+template<typename type_t>
+inline array_kernel_t<type_t> add_n_kernel(isa_t level) noexcept
+{
+    switch (level) {
+    case isa_t::avx512:
+    case isa_t::avx512ifma:
+        return add_n_at<type_t, isa_t::avx512>;
+    case isa_t::avx2:
+        return add_n_at<type_t, isa_t::avx2>;
+    default:
+        return add_n_at<type_t, isa_t::baseline>;
+    }
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+template<typename type_t>
+inline array_kernel_t<type_t> sub_n_kernel(isa_t level) noexcept
+{
+    switch (level) {
+    case isa_t::avx512:
+    case isa_t::avx512ifma:
+        return sub_n_at<type_t, isa_t::avx512>;
+    case isa_t::avx2:
+        return sub_n_at<type_t, isa_t::avx2>;
+    default:
+        return sub_n_at<type_t, isa_t::baseline>;
+    }
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+template<typename type_t>
+inline array_kernel_t<type_t> mul_n_kernel(isa_t level) noexcept
+{
+    // multiplication has no kernels for levels below IFMA
+
+    return level >= isa_t::avx512ifma ? mul_n_at<type_t, isa_t::avx512ifma> : mul_n_at<type_t, isa_t::baseline>;
+}
+
+
+
+#if defined(__GNUC__) && defined(__x86_64__)
+
+// vector types are never passed across functions compiled for different targets
+
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wpsabi"
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+template<uint_t size, uint_t block>
+constexpr uint64_t element_top_mask() noexcept
+{
+    // bit of every most significant digit of elements in block
+
+    uint64_t mask = 0;
+
+    for (uint_t n = size - 1; n < block; n += size)
+        mask |= uint64_t(1) << n;
+
+    return mask;
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+constexpr uint64_t resolve_carries(uint64_t generate, uint64_t propagate, uint64_t top_mask) noexcept
+{
+    // bit n of generate is set if digit n overflows by itself, bit n of propagate is set if digit n
+    // overflows when carry comes in; a single addition ripples carries through runs of propagating
+    // digits, cleared bits of most significant digits stop carries at element boundaries
+
+    generate &= ~top_mask;
+    propagate &= ~top_mask;
+
+    return ((generate << 1) + propagate) ^ propagate;
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+template<uint_t size, bool subtract>
+__attribute__((target("avx2"))) inline size_t add_sub_n_avx2(uint64_t* result, const uint64_t* values1, const uint64_t* values2, size_t count) noexcept
+{
+    constexpr uint_t lanes = 4;
+    constexpr uint_t block = std::max(size, lanes);
+    constexpr uint_t vectors = block / lanes;
+    constexpr uint64_t top_mask = element_top_mask<size, block>();
+
+    static_assert(block <= bit_count_v<uint64_t>, "digits of block must fit carry mask.");
+
+    // AVX2 has signed comparison only, so that operands are biased by the sign bit
+
+    const __m256i sign = _mm256_set1_epi64x(std::numeric_limits<int64_t>::min());
+    const __m256i propagating = _mm256_set1_epi64x(subtract ? 0 : -1);
+    const __m256i lane_index = _mm256_setr_epi64x(0, 1, 2, 3);
+    const __m256i one = _mm256_set1_epi64x(1);
+
+    const size_t digit_count = count * size;
+    size_t n = 0;
+
+    for (; n + block <= digit_count; n += block) {
+
+        __m256i sums[vectors];
+        uint64_t generate = 0;
+        uint64_t propagate = 0;
+
+        for (uint_t v = 0; v < vectors; ++v) {
+
+            const __m256i value1 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(values1 + n + v * lanes));
+            const __m256i value2 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(values2 + n + v * lanes));
+            __m256i overflow;
+
+            if constexpr (subtract) {
+
+                sums[v] = _mm256_sub_epi64(value1, value2);
+                overflow = _mm256_cmpgt_epi64(_mm256_xor_si256(value2, sign), _mm256_xor_si256(value1, sign));
+            } else {
+
+                sums[v] = _mm256_add_epi64(value1, value2);
+                overflow = _mm256_cmpgt_epi64(_mm256_xor_si256(value1, sign), _mm256_xor_si256(sums[v], sign));
+            }
+
+            const __m256i carrying = _mm256_cmpeq_epi64(sums[v], propagating);
+
+            generate |= uint64_t(_mm256_movemask_pd(_mm256_castsi256_pd(overflow))) << (v * lanes);
+            propagate |= uint64_t(_mm256_movemask_pd(_mm256_castsi256_pd(carrying))) << (v * lanes);
+        }
+
+        const uint64_t carries = resolve_carries(generate, propagate, top_mask);
+
+        for (uint_t v = 0; v < vectors; ++v) {
+
+            const __m256i carry_bits = _mm256_set1_epi64x(static_cast<int64_t>(carries >> (v * lanes)));
+            const __m256i carry = _mm256_and_si256(_mm256_srlv_epi64(carry_bits, lane_index), one);
+            const __m256i sum = subtract ? _mm256_sub_epi64(sums[v], carry) : _mm256_add_epi64(sums[v], carry);
+
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(result + n + v * lanes), sum);
+        }
+    }
+
+    return n / size;
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+template<uint_t size, bool subtract>
+__attribute__((target("avx512f"))) inline size_t add_sub_n_avx512(uint64_t* result, const uint64_t* values1, const uint64_t* values2, size_t count) noexcept
+{
+    constexpr uint_t lanes = 8;
+    constexpr uint_t block = std::max(size, lanes);
+    constexpr uint_t vectors = block / lanes;
+    constexpr uint64_t top_mask = element_top_mask<size, block>();
+
+    static_assert(block <= bit_count_v<uint64_t>, "digits of block must fit carry mask.");
+
+    const __m512i propagating = _mm512_set1_epi64(subtract ? 0 : -1);
+    const __m512i one = _mm512_set1_epi64(1);
+
+    const size_t digit_count = count * size;
+    size_t n = 0;
+
+    for (; n + block <= digit_count; n += block) {
+
+        __m512i sums[vectors];
+        uint64_t generate = 0;
+        uint64_t propagate = 0;
+
+        for (uint_t v = 0; v < vectors; ++v) {
+
+            const __m512i value1 = _mm512_loadu_si512(values1 + n + v * lanes);
+            const __m512i value2 = _mm512_loadu_si512(values2 + n + v * lanes);
+            __mmask8 overflow;
+
+            if constexpr (subtract) {
+
+                sums[v] = _mm512_sub_epi64(value1, value2);
+                overflow = _mm512_cmplt_epu64_mask(value1, value2);
+            } else {
+
+                sums[v] = _mm512_add_epi64(value1, value2);
+                overflow = _mm512_cmplt_epu64_mask(sums[v], value1);
+            }
+
+            generate |= uint64_t(overflow) << (v * lanes);
+            propagate |= uint64_t(_mm512_cmpeq_epu64_mask(sums[v], propagating)) << (v * lanes);
+        }
+
+        const uint64_t carries = resolve_carries(generate, propagate, top_mask);
+
+        for (uint_t v = 0; v < vectors; ++v) {
+
+            const __mmask8 carry = static_cast<__mmask8>(carries >> (v * lanes));
+            const __m512i sum = subtract ? _mm512_mask_sub_epi64(sums[v], carry, sums[v], one) : _mm512_mask_add_epi64(sums[v], carry, sums[v], one);
+
+            _mm512_storeu_si512(result + n + v * lanes, sum);
+        }
+    }
+
+    return n / size;
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// immediate shifts of avx512fintrin.h pass _mm512_undefined_epi32() as the merge source, which
+// gcc 12 reports as maybe uninitialized once they are inlined
+
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wmaybe-uninitialized"
+
+__attribute__((target("avx512f,avx512ifma"))) inline size_t mul_n_ifma(uint64_t* result, const uint64_t* values1, const uint64_t* values2, size_t count) noexcept
+{
+    // eight elements are transposed with gathers, so that every vector holds one digit of all of
+    // them, and multiplied with the same column schedule as mul_radix52()
+
+    constexpr uint_t lanes = 8;
+    constexpr uint_t size = 4;
+
+    const __m512i element_index = _mm512_setr_epi64(0, 4, 8, 12, 16, 20, 24, 28);
+    const __m512i mask = _mm512_set1_epi64(radix52_mask);
+
+    const auto to_radix52_lanes = [&](const uint64_t* values, __m512i (&digits)[radix52_size]) __attribute__((target("avx512f"))) {
+
+        // masked gathers with a zero source, unmasked ones leave their source undefined
+
+        const __m512i zero = _mm512_setzero_si512();
+        const __m512i digit0 = _mm512_mask_i64gather_epi64(zero, 0xff, element_index, values + 0, 8);
+        const __m512i digit1 = _mm512_mask_i64gather_epi64(zero, 0xff, element_index, values + 1, 8);
+        const __m512i digit2 = _mm512_mask_i64gather_epi64(zero, 0xff, element_index, values + 2, 8);
+        const __m512i digit3 = _mm512_mask_i64gather_epi64(zero, 0xff, element_index, values + 3, 8);
+
+        digits[0] = _mm512_and_si512(digit0, mask);
+        digits[1] = _mm512_and_si512(_mm512_or_si512(_mm512_srli_epi64(digit0, 52), _mm512_slli_epi64(digit1, 12)), mask);
+        digits[2] = _mm512_and_si512(_mm512_or_si512(_mm512_srli_epi64(digit1, 40), _mm512_slli_epi64(digit2, 24)), mask);
+        digits[3] = _mm512_and_si512(_mm512_or_si512(_mm512_srli_epi64(digit2, 28), _mm512_slli_epi64(digit3, 36)), mask);
+        digits[4] = _mm512_srli_epi64(digit3, 16);
+    };
+
+    size_t n = 0;
+
+    for (; n + lanes <= count; n += lanes) {
+
+        __m512i digits1[radix52_size];
+        __m512i digits2[radix52_size];
+        __m512i columns[radix52_size];
+
+        to_radix52_lanes(values1 + n * size, digits1);
+        to_radix52_lanes(values2 + n * size, digits2);
+
+        for (uint_t k = 0; k < radix52_size; ++k) {
+
+            columns[k] = _mm512_setzero_si512();
+
+            for (uint_t i = 0; i <= k; ++i)
+                columns[k] = _mm512_madd52lo_epu64(columns[k], digits1[i], digits2[k - i]);
+
+            for (uint_t i = 0; k > 0 && i <= k - 1; ++i)
+                columns[k] = _mm512_madd52hi_epu64(columns[k], digits1[i], digits2[k - 1 - i]);
+        }
+
+        for (uint_t k = 1; k < radix52_size; ++k) {
+
+            columns[k] = _mm512_add_epi64(columns[k], _mm512_srli_epi64(columns[k - 1], radix52_bits));
+            columns[k - 1] = _mm512_and_si512(columns[k - 1], mask);
+        }
+
+        const __m512i digit0 = _mm512_or_si512(columns[0], _mm512_slli_epi64(columns[1], 52));
+        const __m512i digit1 = _mm512_or_si512(_mm512_srli_epi64(columns[1], 12), _mm512_slli_epi64(columns[2], 40));
+        const __m512i digit2 = _mm512_or_si512(_mm512_srli_epi64(columns[2], 24), _mm512_slli_epi64(columns[3], 28));
+        const __m512i digit3 = _mm512_or_si512(_mm512_srli_epi64(columns[3], 36), _mm512_slli_epi64(columns[4], 16));
+
+        _mm512_i64scatter_epi64(result + n * size + 0, element_index, digit0, 8);
+        _mm512_i64scatter_epi64(result + n * size + 1, element_index, digit1, 8);
+        _mm512_i64scatter_epi64(result + n * size + 2, element_index, digit2, 8);
+        _mm512_i64scatter_epi64(result + n * size + 3, element_index, digit3, 8);
+    }
+
+    return n;
+}
+
+#pragma GCC diagnostic pop
+
+#pragma GCC diagnostic pop
+
+#endif // defined(__GNUC__) && defined(__x86_64__)
+
+} // namespace impl
+} // namespace slim
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// End of long_simd.h
+////////////////////////////////////////////////////////////////////////////////////////////////////
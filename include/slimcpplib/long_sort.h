@@ -0,0 +1,298 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// Simple Long Integer Math for C++
+// version 2.0
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// Licensed under the MIT License <http://opensource.org/licenses/MIT>.
+// SPDX-License-Identifier: MIT
+//
+// Copyright (c) 2020-2026 Yury Kalmykov <y_kalmykov@mail.ru>.
+//
+// Permission is hereby  granted, free of charge, to any  person obtaining a copy
+// of this software and associated  documentation files (the "Software"), to deal
+// in the Software  without restriction, including without  limitation the rights
+// to  use, copy,  modify, merge,  publish, distribute,  sublicense, and/or  sell
+// copies  of  the Software,  and  to  permit persons  to  whom  the Software  is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE  IS PROVIDED "AS  IS", WITHOUT WARRANTY  OF ANY KIND,  EXPRESS OR
+// IMPLIED,  INCLUDING BUT  NOT  LIMITED TO  THE  WARRANTIES OF  MERCHANTABILITY,
+// FITNESS FOR  A PARTICULAR PURPOSE AND  NONINFRINGEMENT. IN NO EVENT  SHALL THE
+// AUTHORS  OR COPYRIGHT  HOLDERS  BE  LIABLE FOR  ANY  CLAIM,  DAMAGES OR  OTHER
+// LIABILITY, WHETHER IN AN ACTION OF  CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE  OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+
+#pragma once
+
+#include "long_int.h"
+#include "long_uint.h"
+
+#include <algorithm>
+#include <array>
+#include <memory>
+#include <span>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace slim
+{
+namespace impl
+{
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// type definitions
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+constexpr uint_t radix_bits = 8;
+constexpr uint_t radix_size = uint_t(1) << radix_bits;
+
+template<typename type_t>
+using radix_histograms_t = std::array<std::array<size_t, radix_size>, byte_count_v<type_t>>;
+
+// histograms of integers up to 256 bits take up to 64 KB of stack, longer integers allocate them
+
+template<typename type_t>
+constexpr bool radix_histograms_on_stack_v = byte_count_v<type_t> <= 32;
+
+} // namespace impl
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// standalone methods
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+// sort integers in ascending order with least significant digit radix sort by 8 bits per pass:
+// histograms of all passes are gathered by a single read, passes whose bytes are equal in all
+// integers are skipped, signed integers are ordered by flipping the sign bit; the sort is stable,
+// the buffer overload takes scratch space of the same size as values and doesn't allocate for
+// integers up to 256 bits
+
+template<typename type_t, std::enable_if_t<is_long_integer_v<type_t>, int> = 0>
+void radix_sort(std::span<type_t> values);
+template<typename type_t, std::enable_if_t<is_long_integer_v<type_t>, int> = 0>
+void radix_sort(std::span<type_t> values, std::span<type_t> buffer) noexcept(impl::radix_histograms_on_stack_v<type_t>);
+
+// sort keys and reorder associated values the same way, sizes of keys and values must be equal
+
+template<typename type_t, typename value_t, std::enable_if_t<is_long_integer_v<type_t>, int> = 0>
+void radix_sort_by_key(std::span<type_t> keys, std::span<value_t> values);
+
+namespace impl
+{
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// standalone helper methods
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+template<typename type_t>
+constexpr uint_t radix_byte(const type_t& value, uint_t index) noexcept;
+template<typename type_t>
+void radix_histograms(std::span<const type_t> keys, radix_histograms_t<type_t>& histograms) noexcept;
+bool radix_pass_needed(const std::array<size_t, radix_size>& histogram, size_t count) noexcept;
+template<typename type_t, typename value_t, bool with_values>
+void radix_sort_passes(std::span<type_t> keys, std::span<type_t> key_buffer, std::span<value_t> values, std::span<value_t> value_buffer) noexcept(radix_histograms_on_stack_v<type_t> && (!with_values || std::is_nothrow_move_assignable_v<value_t>));
+template<typename type_t, typename value_t, bool with_values>
+void radix_sort_passes(std::span<type_t> keys, std::span<type_t> key_buffer, std::span<value_t> values, std::span<value_t> value_buffer, radix_histograms_t<type_t>& histograms) noexcept(!with_values || std::is_nothrow_move_assignable_v<value_t>);
+
+} // namespace impl
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// standalone methods
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+template<typename type_t, std::enable_if_t<is_long_integer_v<type_t>, int>>
+inline void radix_sort(std::span<type_t> values)
+{
+    std::vector<type_t> buffer(values.size());
+
+    radix_sort(values, std::span<type_t>(buffer));
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+template<typename type_t, std::enable_if_t<is_long_integer_v<type_t>, int>>
+inline void radix_sort(std::span<type_t> values, std::span<type_t> buffer) noexcept(impl::radix_histograms_on_stack_v<type_t>)
+{
+    assert(buffer.size() >= values.size());
+
+    impl::radix_sort_passes<type_t, type_t, false>(values, buffer.first(values.size()), {}, {});
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+template<typename type_t, typename value_t, std::enable_if_t<is_long_integer_v<type_t>, int>>
+inline void radix_sort_by_key(std::span<type_t> keys, std::span<value_t> values)
+{
+    assert(keys.size() == values.size());
+
+    std::vector<type_t> key_buffer(keys.size());
+    std::vector<value_t> value_buffer(values.size());
+
+    impl::radix_sort_passes<type_t, value_t, true>(keys, std::span<type_t>(key_buffer), values, std::span<value_t>(value_buffer));
+}
+
+
+
+namespace impl
+{
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// standalone helper methods
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+template<typename type_t>
+constexpr uint_t radix_byte(const type_t& value, uint_t index) noexcept
+{
+    using native_t = typename type_t::native_array_t::value_type;
+
+    // bytes are numbered from the least significant one, sign bit of signed integers is flipped,
+    // so that negative values precede positive ones
+
+    const native_t digit = value.digits[index / byte_count_v<native_t>];
+    uint_t byte = static_cast<uint_t>(digit >> (index % byte_count_v<native_t> * radix_bits)) & (radix_size - 1);
+
+    if constexpr (is_signed_v<type_t>) {
+
+        if (index == byte_count_v<type_t> - 1)
+            byte ^= radix_size / 2;
+    }
+
+    return byte;
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+template<typename type_t>
+inline void radix_histograms(std::span<const type_t> keys, radix_histograms_t<type_t>& histograms) noexcept
+{
+    for (std::array<size_t, radix_size>& histogram : histograms)
+        histogram.fill(0);
+
+    using native_t = typename type_t::native_array_t::value_type;
+
+    // bytes are taken from native digits by shifts rather than extracted one by one
+
+    for (const type_t& key : keys) {
+
+        uint_t index = 0;
+
+        for (native_t digit : key.digits) {
+
+            for (uint_t n = 0; n < byte_count_v<native_t>; ++n, ++index, digit >>= radix_bits)
+                ++histograms[index][static_cast<uint_t>(digit) & (radix_size - 1)];
+        }
+
+        if constexpr (is_signed_v<type_t>) {
+
+            // move the count of the top byte to the bucket with the flipped sign bit
+
+            const uint_t byte = static_cast<uint_t>(key.digits.back() >> (bit_count_v<native_t> - radix_bits));
+
+            --histograms[byte_count_v<type_t> - 1][byte];
+            ++histograms[byte_count_v<type_t> - 1][byte ^ (radix_size / 2)];
+        }
+    }
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+inline bool radix_pass_needed(const std::array<size_t, radix_size>& histogram, size_t count) noexcept
+{
+    // pass is useless if all keys fall into a single bucket
+
+    return std::none_of(histogram.begin(), histogram.end(), [count](size_t bucket) { return bucket == count; });
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+template<typename type_t, typename value_t, bool with_values>
+inline void radix_sort_passes(std::span<type_t> keys, std::span<type_t> key_buffer, std::span<value_t> values, std::span<value_t> value_buffer) noexcept(radix_histograms_on_stack_v<type_t> && (!with_values || std::is_nothrow_move_assignable_v<value_t>))
+{
+    if (keys.size() < 2)
+        return;
+
+    if constexpr (radix_histograms_on_stack_v<type_t>) {
+
+        radix_histograms_t<type_t> histograms;
+        radix_sort_passes<type_t, value_t, with_values>(keys, key_buffer, values, value_buffer, histograms);
+    } else {
+
+        const std::unique_ptr<radix_histograms_t<type_t>> histograms = std::make_unique<radix_histograms_t<type_t>>();
+        radix_sort_passes<type_t, value_t, with_values>(keys, key_buffer, values, value_buffer, *histograms);
+    }
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+template<typename type_t, typename value_t, bool with_values>
+inline void radix_sort_passes(std::span<type_t> keys, std::span<type_t> key_buffer, std::span<value_t> values, std::span<value_t> value_buffer, radix_histograms_t<type_t>& histograms) noexcept(!with_values || std::is_nothrow_move_assignable_v<value_t>)
+{
+    radix_histograms(std::span<const type_t>(keys), histograms);
+
+    std::span<type_t> source_keys = keys;
+    std::span<type_t> target_keys = key_buffer;
+    std::span<value_t> source_values = values;
+    std::span<value_t> target_values = value_buffer;
+
+    for (uint_t index = 0; index < byte_count_v<type_t>; ++index) {
+
+        if (!radix_pass_needed(histograms[index], keys.size()))
+            continue;
+
+        // exclusive prefix sums are the first positions of buckets
+
+        std::array<size_t, radix_size> offsets;
+        size_t offset = 0;
+
+        for (uint_t bucket = 0; bucket < radix_size; ++bucket) {
+
+            offsets[bucket] = offset;
+            offset += histograms[index][bucket];
+        }
+
+        for (size_t n = 0; n < source_keys.size(); ++n) {
+
+            const size_t position = offsets[radix_byte(source_keys[n], index)]++;
+
+            target_keys[position] = source_keys[n];
+
+            if constexpr (with_values)
+                target_values[position] = std::move(source_values[n]);
+        }
+
+        std::swap(source_keys, target_keys);
+
+        if constexpr (with_values)
+            std::swap(source_values, target_values);
+    }
+
+    // odd number of passes leaves the result in the buffer
+
+    if (source_keys.data() != keys.data()) {
+
+        std::copy(source_keys.begin(), source_keys.end(), keys.begin());
+
+        if constexpr (with_values)
+            std::move(source_values.begin(), source_values.end(), values.begin());
+    }
+}
+
+} // namespace impl
+} // namespace slim
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// End of long_sort.h
+////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -82,11 +82,15 @@ public:
     explicit constexpr operator long_uint_t<native_t, other_size>() const noexcept;
     template<typename type_t, std::enable_if_t<std::is_unsigned_v<type_t>, int> = 0>
     explicit constexpr operator type_t() const noexcept;
-    template<typename type_t, std::enable_if_t<std::is_signed_v<type_t>, int> = 0>
+    template<typename type_t, std::enable_if_t<std::is_integral_v<type_t> && std::is_signed_v<type_t>, int> = 0>
+    explicit constexpr operator type_t() const noexcept;
+    template<typename type_t, std::enable_if_t<std::is_floating_point_v<type_t>, int> = 0>
     explicit constexpr operator type_t() const noexcept;
     constexpr bool operator==(const long_uint_t& that) const noexcept;
     template<typename type_t, std::enable_if_t<is_integer_v<type_t> && byte_count_v<type_t> <= byte_count_v<native_t>, int> = 0>
     constexpr bool operator==(type_t value) const noexcept;
+    template<uint_t other_size, std::enable_if_t<(other_size < size), int> = 0>
+    constexpr bool operator==(const long_uint_t<native_t, other_size>& that) const noexcept;
     constexpr bool operator!=(const long_uint_t& that) const noexcept;
     template<typename type_t, std::enable_if_t<is_integer_v<type_t> && byte_count_v<type_t> <= byte_count_v<native_t>, int> = 0>
     constexpr bool operator!=(type_t value) const noexcept;
@@ -94,6 +98,9 @@ public:
     constexpr bool operator<=(const long_uint_t& that) const noexcept;
     constexpr bool operator>(const long_uint_t& that) const noexcept;
     constexpr bool operator>=(const long_uint_t& that) const noexcept;
+    constexpr std::strong_ordering operator<=>(const long_uint_t& that) const noexcept;
+    template<uint_t other_size, std::enable_if_t<(other_size < size), int> = 0>
+    constexpr std::strong_ordering operator<=>(const long_uint_t<native_t, other_size>& that) const noexcept;
     template<typename type_t, std::enable_if_t<std::is_integral_v<type_t> && byte_count_v<type_t> <= byte_count_v<native_t>, int> = 0>
     constexpr bool operator<(type_t value) const noexcept;
     template<typename type_t, std::enable_if_t<std::is_integral_v<type_t> && byte_count_v<type_t> <= byte_count_v<native_t>, int> = 0>
@@ -102,6 +109,8 @@ public:
     constexpr bool operator>(type_t value) const noexcept;
     template<typename type_t, std::enable_if_t<std::is_integral_v<type_t> && byte_count_v<type_t> <= byte_count_v<native_t>, int> = 0>
     constexpr bool operator>=(type_t value) const noexcept;
+    template<typename type_t, std::enable_if_t<std::is_integral_v<type_t> && byte_count_v<type_t> <= byte_count_v<native_t>, int> = 0>
+    constexpr std::strong_ordering operator<=>(type_t value) const noexcept;
     constexpr long_uint_t operator~() const noexcept;
     constexpr long_uint_t& operator&=(const long_uint_t& that) noexcept;
     template<typename type_t, std::enable_if_t<is_integer_v<type_t> && byte_count_v<type_t> <= byte_count_v<native_t>, int> = 0>
@@ -131,6 +140,10 @@ public:
     constexpr long_uint_t operator+(const long_uint_t& that) const noexcept;
     template<typename type_t, std::enable_if_t<is_integer_v<type_t> && byte_count_v<type_t> <= byte_count_v<native_t>, int> = 0>
     constexpr long_uint_t operator+(type_t value) const noexcept;
+    template<uint_t other_size, std::enable_if_t<(other_size < size), int> = 0>
+    constexpr long_uint_t& operator+=(const long_uint_t<native_t, other_size>& that) noexcept;
+    template<uint_t other_size, std::enable_if_t<(other_size < size), int> = 0>
+    constexpr long_uint_t operator+(const long_uint_t<native_t, other_size>& that) const noexcept;
     constexpr long_uint_t& operator++() noexcept;
     constexpr long_uint_t operator++(int) noexcept;
     constexpr long_uint_t operator+() const noexcept;
@@ -140,11 +153,19 @@ public:
     constexpr long_uint_t operator-(const long_uint_t& that) const noexcept;
     template<typename type_t, std::enable_if_t<is_integer_v<type_t> && byte_count_v<type_t> <= byte_count_v<native_t>, int> = 0>
     constexpr long_uint_t operator-(type_t value) const noexcept;
+    template<uint_t other_size, std::enable_if_t<(other_size < size), int> = 0>
+    constexpr long_uint_t& operator-=(const long_uint_t<native_t, other_size>& that) noexcept;
+    template<uint_t other_size, std::enable_if_t<(other_size < size), int> = 0>
+    constexpr long_uint_t operator-(const long_uint_t<native_t, other_size>& that) const noexcept;
     constexpr long_uint_t& operator--() noexcept;
     constexpr long_uint_t operator--(int) noexcept;
     constexpr long_uint_t operator-() const noexcept;
     constexpr long_uint_t& operator*=(const long_uint_t& that) noexcept;
     constexpr long_uint_t operator*(const long_uint_t& that) const noexcept;
+    template<uint_t other_size, std::enable_if_t<(other_size < size), int> = 0>
+    constexpr long_uint_t& operator*=(const long_uint_t<native_t, other_size>& that) noexcept;
+    template<uint_t other_size, std::enable_if_t<(other_size < size), int> = 0>
+    constexpr long_uint_t operator*(const long_uint_t<native_t, other_size>& that) const noexcept;
     constexpr long_uint_t& operator/=(const long_uint_t& that) noexcept;
     constexpr long_uint_t operator/(const long_uint_t& that) const noexcept;
     constexpr long_uint_t& operator%=(const long_uint_t& that) noexcept;
@@ -165,6 +186,33 @@ public:
 template<typename type_t, std::enable_if_t<is_unsigned_v<type_t>, int> = 0>
 constexpr type_t muldiv(const type_t& value, const type_t& multiplier, const type_t& divider) noexcept;
 
+// convert to floating point value rounded to nearest (ties to even)
+
+template<typename float_t, typename native_t, uint_t size, std::enable_if_t<std::is_floating_point_v<float_t>, int> = 0>
+constexpr float_t to_floating(const long_uint_t<native_t, size>& value) noexcept;
+template<typename native_t, uint_t size>
+constexpr float to_float(const long_uint_t<native_t, size>& value) noexcept;
+template<typename native_t, uint_t size>
+constexpr double to_double(const long_uint_t<native_t, size>& value) noexcept;
+template<typename native_t, uint_t size>
+constexpr long double to_long_double(const long_uint_t<native_t, size>& value) noexcept;
+
+// convert from floating point value truncated toward zero (NaN and negative values give zero, too big values saturate)
+
+template<typename type_t, typename float_t, std::enable_if_t<is_unsigned_v<type_t> && std::is_floating_point_v<float_t>, int> = 0>
+constexpr type_t from_floating(float_t value) noexcept;
+template<typename type_t, std::enable_if_t<is_unsigned_v<type_t>, int> = 0>
+constexpr type_t from_double(double value) noexcept;
+
+// calculate integer logarithms and the number of decimal digits (zero value has zero logarithms and one digit)
+
+template<typename native_t, uint_t size>
+constexpr uint_t ilog2(const long_uint_t<native_t, size>& value) noexcept;
+template<typename native_t, uint_t size>
+constexpr uint_t ilog10(const long_uint_t<native_t, size>& value) noexcept;
+template<typename native_t, uint_t size>
+constexpr uint_t decimal_digits(const long_uint_t<native_t, size>& value) noexcept;
+
 
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -272,7 +320,7 @@ constexpr long_uint_t<native_t, size>::operator type_t() const noexcept
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 template<typename native_t, uint_t size>
-template<typename type_t, std::enable_if_t<std::is_signed_v<type_t>, int>>
+template<typename type_t, std::enable_if_t<std::is_integral_v<type_t> && std::is_signed_v<type_t>, int>>
 constexpr long_uint_t<native_t, size>::operator type_t() const noexcept
 {
     return static_cast<type_t>(digits[lo]);
@@ -280,6 +328,16 @@ constexpr long_uint_t<native_t, size>::operator type_t() const noexcept
 
 
 
+////////////////////////////////////////////////////////////////////////////////////////////////////
+template<typename native_t, uint_t size>
+template<typename type_t, std::enable_if_t<std::is_floating_point_v<type_t>, int>>
+constexpr long_uint_t<native_t, size>::operator type_t() const noexcept
+{
+    return to_floating<type_t>(*this);
+}
+
+
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 template<typename native_t, uint_t size>
 constexpr bool long_uint_t<native_t, size>::operator==(const long_uint_t& that) const noexcept
@@ -322,6 +380,28 @@ constexpr bool long_uint_t<native_t, size>::operator==(type_t value) const noexc
 
 
 
+////////////////////////////////////////////////////////////////////////////////////////////////////
+template<typename native_t, uint_t size>
+template<uint_t other_size, std::enable_if_t<(other_size < size), int>>
+constexpr bool long_uint_t<native_t, size>::operator==(const long_uint_t<native_t, other_size>& that) const noexcept
+{
+    for (uint_t n = std::size(digits); n-- > other_size;) {
+
+        if (digits[n] != 0)
+            return false;
+    }
+
+    for (uint_t n = other_size; n-- > 0;) {
+
+        if (digits[n] != that.digits[n])
+            return false;
+    }
+
+    return true;
+}
+
+
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 template<typename native_t, uint_t size>
 constexpr bool long_uint_t<native_t, size>::operator!=(const long_uint_t& that) const noexcept
@@ -386,6 +466,48 @@ constexpr bool long_uint_t<native_t, size>::operator>=(const long_uint_t& that)
 
 
 
+////////////////////////////////////////////////////////////////////////////////////////////////////
+template<typename native_t, uint_t size>
+constexpr std::strong_ordering long_uint_t<native_t, size>::operator<=>(const long_uint_t& that) const noexcept
+{
+    int_t order = 0;
+
+    // keep the order of the most significant differing digit, scanning all digits without branches
+
+    for (uint_t n = std::size(digits); n-- > 0;) {
+
+        const int_t digit_order = int_t(digits[n] > that.digits[n]) - int_t(digits[n] < that.digits[n]);
+        order = order != 0 ? order : digit_order;
+    }
+
+    return order <=> 0;
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+template<typename native_t, uint_t size>
+template<uint_t other_size, std::enable_if_t<(other_size < size), int>>
+constexpr std::strong_ordering long_uint_t<native_t, size>::operator<=>(const long_uint_t<native_t, other_size>& that) const noexcept
+{
+    int_t order = 0;
+
+    // any non-zero upper digit makes this value greater
+
+    for (uint_t n = std::size(digits); n-- > other_size;)
+        order = order != 0 ? order : int_t(digits[n] != 0);
+
+    for (uint_t n = other_size; n-- > 0;) {
+
+        const int_t digit_order = int_t(digits[n] > that.digits[n]) - int_t(digits[n] < that.digits[n]);
+        order = order != 0 ? order : digit_order;
+    }
+
+    return order <=> 0;
+}
+
+
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 template<typename native_t, uint_t size>
 template<typename type_t, std::enable_if_t<std::is_integral_v<type_t> && byte_count_v<type_t> <= byte_count_v<native_t>, int>>
@@ -440,6 +562,34 @@ constexpr bool long_uint_t<native_t, size>::operator>=(type_t value) const noexc
 
 
 
+////////////////////////////////////////////////////////////////////////////////////////////////////
+template<typename native_t, uint_t size>
+template<typename type_t, std::enable_if_t<std::is_integral_v<type_t> && byte_count_v<type_t> <= byte_count_v<native_t>, int>>
+constexpr std::strong_ordering long_uint_t<native_t, size>::operator<=>(type_t value) const noexcept
+{
+    native_t extension = native_t(0);
+
+    if constexpr (std::is_signed_v<type_t>) {
+
+        if (value < 0)
+            extension = native_t(~native_t(0));
+    }
+
+    int_t order = int_t(digits[0] > native_t(value)) - int_t(digits[0] < native_t(value));
+
+    // higher digits override the order of lower ones unless they are equal to the extension
+
+    for (uint_t n = 1; n < std::size(digits); ++n) {
+
+        const int_t digit_order = int_t(digits[n] > extension) - int_t(digits[n] < extension);
+        order = digit_order != 0 ? digit_order : order;
+    }
+
+    return order <=> 0;
+}
+
+
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 template<typename native_t, uint_t size>
 constexpr long_uint_t<native_t, size> long_uint_t<native_t, size>::operator~() const noexcept
@@ -781,6 +931,32 @@ constexpr long_uint_t<native_t, size> long_uint_t<native_t, size>::operator+(typ
 
 
 
+////////////////////////////////////////////////////////////////////////////////////////////////////
+template<typename native_t, uint_t size>
+template<uint_t other_size, std::enable_if_t<(other_size < size), int>>
+constexpr long_uint_t<native_t, size>& long_uint_t<native_t, size>::operator+=(const long_uint_t<native_t, other_size>& that) noexcept
+{
+    add(digits, that.digits);
+
+    return *this;
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+template<typename native_t, uint_t size>
+template<uint_t other_size, std::enable_if_t<(other_size < size), int>>
+constexpr long_uint_t<native_t, size> long_uint_t<native_t, size>::operator+(const long_uint_t<native_t, other_size>& that) const noexcept
+{
+    long_uint_t tmp = *this;
+
+    tmp += that;
+
+    return tmp;
+}
+
+
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 template<typename native_t, uint_t size>
 constexpr long_uint_t<native_t, size>& long_uint_t<native_t, size>::operator++() noexcept
@@ -878,6 +1054,32 @@ constexpr long_uint_t<native_t, size> long_uint_t<native_t, size>::operator-(typ
 
 
 
+////////////////////////////////////////////////////////////////////////////////////////////////////
+template<typename native_t, uint_t size>
+template<uint_t other_size, std::enable_if_t<(other_size < size), int>>
+constexpr long_uint_t<native_t, size>& long_uint_t<native_t, size>::operator-=(const long_uint_t<native_t, other_size>& that) noexcept
+{
+    sub(digits, that.digits);
+
+    return *this;
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+template<typename native_t, uint_t size>
+template<uint_t other_size, std::enable_if_t<(other_size < size), int>>
+constexpr long_uint_t<native_t, size> long_uint_t<native_t, size>::operator-(const long_uint_t<native_t, other_size>& that) const noexcept
+{
+    long_uint_t tmp = *this;
+
+    tmp -= that;
+
+    return tmp;
+}
+
+
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 template<typename native_t, uint_t size>
 constexpr long_uint_t<native_t, size>& long_uint_t<native_t, size>::operator--() noexcept
@@ -948,6 +1150,32 @@ constexpr long_uint_t<native_t, size> long_uint_t<native_t, size>::operator*(con
 
 
 
+////////////////////////////////////////////////////////////////////////////////////////////////////
+template<typename native_t, uint_t size>
+template<uint_t other_size, std::enable_if_t<(other_size < size), int>>
+constexpr long_uint_t<native_t, size>& long_uint_t<native_t, size>::operator*=(const long_uint_t<native_t, other_size>& that) noexcept
+{
+    mul(digits, that.digits);
+
+    return *this;
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+template<typename native_t, uint_t size>
+template<uint_t other_size, std::enable_if_t<(other_size < size), int>>
+constexpr long_uint_t<native_t, size> long_uint_t<native_t, size>::operator*(const long_uint_t<native_t, other_size>& that) const noexcept
+{
+    long_uint_t tmp = *this;
+
+    tmp *= that;
+
+    return tmp;
+}
+
+
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 template<typename native_t, uint_t size>
 constexpr long_uint_t<native_t, size>& long_uint_t<native_t, size>::operator/=(const long_uint_t& that) noexcept
@@ -1205,6 +1433,258 @@ constexpr type_t muldiv(const type_t& value, const type_t& multiplier, const typ
     return divq2(mul_hi, mul_lo, divider);
 }
 
+namespace impl
+{
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// floating point helper methods
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+template<typename float_t>
+constexpr float_t pow2(uint_t exponent) noexcept
+{
+    using limits_t = std::numeric_limits<float_t>;
+
+    if constexpr (limits_t::is_iec559 && (sizeof(float_t) == sizeof(uint32_t) || sizeof(float_t) == sizeof(uint64_t))) {
+
+        // compose the power of two directly from the biased exponent field
+
+        using bits_t = std::conditional_t<sizeof(float_t) == sizeof(uint32_t), uint32_t, uint64_t>;
+        constexpr uint_t bias = limits_t::max_exponent - 1;
+
+        if (exponent > bias)
+            return limits_t::infinity();
+
+        return std::bit_cast<float_t>(static_cast<bits_t>(bits_t(exponent + bias) << (limits_t::digits - 1)));
+
+    } else {
+
+        float_t result = 1;
+        float_t base = 2;
+
+        for (; exponent > 0; exponent >>= 1) {
+
+            if (exponent & 1)
+                result *= base;
+
+            base *= base;
+        }
+
+        return result;
+    }
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+template<typename float_t, typename native_t, uint_t size>
+constexpr float_t to_floating_exact(const long_uint_t<native_t, size>& value, uint_t top) noexcept
+{
+    // every digit below the mantissa limit converts and accumulates exactly
+
+    float_t result = 0;
+
+    for (uint_t n = top + 1; n-- > 0;)
+        result = result * pow2<float_t>(bit_count_v<native_t>) + static_cast<float_t>(value.digits[n]);
+
+    return result;
+}
+
+} // namespace impl
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+template<typename float_t, typename native_t, uint_t size, std::enable_if_t<std::is_floating_point_v<float_t>, int>>
+constexpr float_t to_floating(const long_uint_t<native_t, size>& value) noexcept
+{
+    using long_uint_t = long_uint_t<native_t, size>;
+
+    constexpr uint_t mantissa_bits = std::numeric_limits<float_t>::digits;
+    constexpr uint_t native_bits = bit_count_v<native_t>;
+
+    const uint_t bits = bit_count_v<long_uint_t> - nlz(value);
+    const uint_t top = bits > 0 ? (bits - 1) / native_bits : 0;
+
+    if (bits <= mantissa_bits)
+        return impl::to_floating_exact<float_t>(value, top);
+
+    const uint_t shift = bits - mantissa_bits;
+
+    if constexpr (mantissa_bits < native_bits) {
+
+        // normalize the top two digits into a single window with the most significant bit set
+
+        const native_t digit_hi = value.digits[top];
+        const native_t digit_lo = top > 0 ? value.digits[top - 1] : native_t(0);
+        const uint_t count = nlz(digit_hi);
+        const native_t window = shl2(digit_hi, digit_lo, count);
+        native_t sticky = static_cast<native_t>(digit_lo << count);
+
+        for (uint_t n = 0; n + 1 < top; ++n)
+            sticky |= value.digits[n];
+
+        // round the window to mantissa bits, to nearest with ties to even
+
+        constexpr uint_t drop_bits = native_bits - mantissa_bits;
+        constexpr native_t half = native_t(1) << (drop_bits - 1);
+
+        native_t mantissa = window >> drop_bits;
+        const native_t rest = window & native_t((native_t(1) << drop_bits) - 1);
+
+        if (rest > half || (rest == half && (sticky != 0 || (mantissa & 1) != 0)))
+            ++mantissa;
+
+        return static_cast<float_t>(mantissa) * impl::pow2<float_t>(shift);
+
+    } else {
+
+        // mantissa spans several digits, round with long arithmetic
+
+        long_uint_t mantissa = value >> shift;
+        const long_uint_t rest = value - (mantissa << shift);
+        const long_uint_t half = long_uint_t(1) << (shift - 1);
+
+        if (rest > half || (rest == half && (mantissa.digits[0] & 1) != 0))
+            ++mantissa;
+
+        const uint_t mantissa_top = (bit_count_v<long_uint_t> - nlz(mantissa) - 1) / native_bits;
+
+        return impl::to_floating_exact<float_t>(mantissa, mantissa_top) * impl::pow2<float_t>(shift);
+    }
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+template<typename native_t, uint_t size>
+constexpr float to_float(const long_uint_t<native_t, size>& value) noexcept
+{
+    return to_floating<float>(value);
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+template<typename native_t, uint_t size>
+constexpr double to_double(const long_uint_t<native_t, size>& value) noexcept
+{
+    return to_floating<double>(value);
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+template<typename native_t, uint_t size>
+constexpr long double to_long_double(const long_uint_t<native_t, size>& value) noexcept
+{
+    return to_floating<long double>(value);
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+template<typename type_t, typename float_t, std::enable_if_t<is_unsigned_v<type_t> && std::is_floating_point_v<float_t>, int>>
+constexpr type_t from_floating(float_t value) noexcept
+{
+    using native_t = typename type_t::native_array_t::value_type;
+
+    if (!(value >= float_t(1)))
+        return type_t(0);
+
+    if (value >= impl::pow2<float_t>(bit_count_v<type_t>))
+        return std::numeric_limits<type_t>::max();
+
+    // peel digits from the top, every step is exact because scaling is a power of two
+
+    type_t result = 0;
+
+    for (uint_t n = std::size(result.digits); n-- > 0;) {
+
+        const float_t scale = impl::pow2<float_t>(n * bit_count_v<native_t>);
+
+        if (value >= scale) {
+
+            const native_t digit = static_cast<native_t>(value / scale);
+            result.digits[n] = digit;
+            value -= static_cast<float_t>(digit) * scale;
+        }
+    }
+
+    return result;
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+template<typename type_t, std::enable_if_t<is_unsigned_v<type_t>, int>>
+constexpr type_t from_double(double value) noexcept
+{
+    return from_floating<type_t>(value);
+}
+
+namespace impl
+{
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// integer logarithm helper methods
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+template<typename type_t>
+constexpr auto make_pow10_table() noexcept
+{
+    // all powers of ten up to the largest decimal logarithm estimate
+
+    std::array<type_t, (bit_count_v<type_t> * 1233 >> 12) + 1> table;
+    type_t power = 1;
+
+    for (type_t& entry : table) {
+
+        entry = power;
+        power *= 10;
+    }
+
+    return table;
+}
+
+template<typename type_t>
+constexpr auto pow10_table = make_pow10_table<type_t>();
+
+} // namespace impl
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+template<typename native_t, uint_t size>
+constexpr uint_t ilog2(const long_uint_t<native_t, size>& value) noexcept
+{
+    const uint_t bit_length = bit_count_v<long_uint_t<native_t, size>> - nlz(value);
+
+    return bit_length > 0 ? bit_length - 1 : 0;
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+template<typename native_t, uint_t size>
+constexpr uint_t ilog10(const long_uint_t<native_t, size>& value) noexcept
+{
+    // bit_length * 1233 / 4096 approximates bit_length * log10(2) from below, so it is either
+    // the decimal logarithm or one more than it
+
+    const uint_t bit_length = bit_count_v<long_uint_t<native_t, size>> - nlz(value);
+    const uint_t estimate = bit_length * 1233 >> 12;
+
+    return estimate - uint_t(estimate > 0 && value < impl::pow10_table<long_uint_t<native_t, size>>[estimate]);
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+template<typename native_t, uint_t size>
+constexpr uint_t decimal_digits(const long_uint_t<native_t, size>& value) noexcept
+{
+    return ilog10(value) + 1;
+}
+
 namespace impl
 {
 ////////////////////////////////////////////////////////////////////////////////////////////////////
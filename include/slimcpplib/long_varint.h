@@ -0,0 +1,488 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// Simple Long Integer Math for C++
+// version 2.0
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// Licensed under the MIT License <http://opensource.org/licenses/MIT>.
+// SPDX-License-Identifier: MIT
+//
+// Copyright (c) 2020-2026 Yury Kalmykov <y_kalmykov@mail.ru>.
+//
+// Permission is hereby  granted, free of charge, to any  person obtaining a copy
+// of this software and associated  documentation files (the "Software"), to deal
+// in the Software  without restriction, including without  limitation the rights
+// to  use, copy,  modify, merge,  publish, distribute,  sublicense, and/or  sell
+// copies  of  the Software,  and  to  permit persons  to  whom  the Software  is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE  IS PROVIDED "AS  IS", WITHOUT WARRANTY  OF ANY KIND,  EXPRESS OR
+// IMPLIED,  INCLUDING BUT  NOT  LIMITED TO  THE  WARRANTIES OF  MERCHANTABILITY,
+// FITNESS FOR  A PARTICULAR PURPOSE AND  NONINFRINGEMENT. IN NO EVENT  SHALL THE
+// AUTHORS  OR COPYRIGHT  HOLDERS  BE  LIABLE FOR  ANY  CLAIM,  DAMAGES OR  OTHER
+// LIABILITY, WHETHER IN AN ACTION OF  CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE  OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+#pragma once
+
+#include "long_bytes.h"
+#include "long_uint.h"
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <span>
+
+namespace slim
+{
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// constants
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+// maximum encoded size of integer, signed integers are zigzag encoded and have the same maximum
+
+template<typename type_t, std::enable_if_t<is_long_integer_v<type_t>, int> = 0>
+constexpr size_t leb128_max_size_v = (bit_count_v<type_t> + 6) / 7;
+template<typename type_t, std::enable_if_t<is_long_integer_v<type_t>, int> = 0>
+constexpr size_t prefix_varint_max_size_v = byte_count_v<type_t> + 1;
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// standalone methods
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+// map signed integer to unsigned one, interleaving positive and negative values: 0, -1, 1, -2, 2...
+
+template<typename native_t, uint_t size>
+constexpr long_uint_t<native_t, size> zigzag_encode(const long_int_t<native_t, size>& value) noexcept;
+template<typename native_t, uint_t size>
+constexpr long_int_t<native_t, size> zigzag_decode(const long_uint_t<native_t, size>& value) noexcept;
+
+// calculate encoded size of integer
+
+template<typename type_t, std::enable_if_t<is_long_integer_v<type_t>, int> = 0>
+constexpr size_t leb128_size(const type_t& value) noexcept;
+template<typename type_t, std::enable_if_t<is_long_integer_v<type_t>, int> = 0>
+constexpr size_t prefix_varint_size(const type_t& value) noexcept;
+
+// calculate size of prefix varint from its first byte
+
+template<typename type_t, std::enable_if_t<is_long_integer_v<type_t>, int> = 0>
+constexpr size_t prefix_varint_length(std::byte first_byte) noexcept;
+
+// encode integer, returning number of written bytes or zero if bytes are too short
+
+template<typename type_t, std::enable_if_t<is_long_integer_v<type_t>, int> = 0>
+constexpr size_t encode_leb128(const type_t& value, std::span<std::byte> bytes) noexcept;
+template<typename type_t, std::enable_if_t<is_long_integer_v<type_t>, int> = 0>
+constexpr size_t encode_prefix_varint(const type_t& value, std::span<std::byte> bytes) noexcept;
+
+// decode integer, returning number of consumed bytes or zero if encoding is truncated or doesn't fit type
+
+template<typename type_t, std::enable_if_t<is_long_integer_v<type_t>, int> = 0>
+constexpr size_t decode_leb128(std::span<const std::byte> bytes, type_t& value) noexcept;
+template<typename type_t, std::enable_if_t<is_long_integer_v<type_t>, int> = 0>
+constexpr size_t decode_prefix_varint(std::span<const std::byte> bytes, type_t& value) noexcept;
+
+// bulk versions, returning total number of written or consumed bytes or zero on error
+
+template<typename type_t, size_t extent, std::enable_if_t<is_long_integer_v<std::remove_const_t<type_t>>, int> = 0>
+constexpr size_t encode_leb128(std::span<type_t, extent> values, std::span<std::byte> bytes) noexcept;
+template<typename type_t, size_t extent, std::enable_if_t<is_long_integer_v<std::remove_const_t<type_t>>, int> = 0>
+constexpr size_t encode_prefix_varint(std::span<type_t, extent> values, std::span<std::byte> bytes) noexcept;
+template<typename type_t, size_t extent, std::enable_if_t<is_long_integer_v<type_t>, int> = 0>
+constexpr size_t decode_leb128(std::span<const std::byte> bytes, std::span<type_t, extent> values) noexcept;
+template<typename type_t, size_t extent, std::enable_if_t<is_long_integer_v<type_t>, int> = 0>
+constexpr size_t decode_prefix_varint(std::span<const std::byte> bytes, std::span<type_t, extent> values) noexcept;
+
+namespace impl
+{
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// constants
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+// first bytes below the limit hold the value itself, the rest hold the number of following bytes
+
+template<typename type_t>
+constexpr uint_t prefix_varint_direct_limit_v = 256 - byte_count_v<type_t>;
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// standalone helper methods
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+template<typename type_t>
+constexpr make_unsigned_t<type_t> to_varint_unsigned(const type_t& value) noexcept;
+template<typename type_t>
+constexpr type_t from_varint_unsigned(const make_unsigned_t<type_t>& value) noexcept;
+template<typename native_t, uint_t size>
+constexpr uint_t bit_length(const long_uint_t<native_t, size>& value) noexcept;
+template<typename native_t, uint_t size>
+constexpr uint_t get_leb128_group(const long_uint_t<native_t, size>& value, uint_t position) noexcept;
+template<typename native_t, uint_t size>
+constexpr void put_leb128_group(long_uint_t<native_t, size>& value, uint_t position, uint_t group) noexcept;
+
+} // namespace impl
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// standalone methods
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+template<typename native_t, uint_t size>
+constexpr long_uint_t<native_t, size> zigzag_encode(const long_int_t<native_t, size>& value) noexcept
+{
+    // shift sign out of the most significant bit and invert magnitude bits of negative values
+
+    const long_uint_t<native_t, size> mask = value.sign() ? ~long_uint_t<native_t, size>(0U) : long_uint_t<native_t, size>(0U);
+
+    return (long_uint_t<native_t, size>(value.digits) << 1) ^ mask;
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+template<typename native_t, uint_t size>
+constexpr long_int_t<native_t, size> zigzag_decode(const long_uint_t<native_t, size>& value) noexcept
+{
+    const long_uint_t<native_t, size> mask = (value.digits[0] & 1) != 0 ? ~long_uint_t<native_t, size>(0U) : long_uint_t<native_t, size>(0U);
+
+    return long_int_t<native_t, size>((value >> 1) ^ mask);
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+template<typename type_t, std::enable_if_t<is_long_integer_v<type_t>, int>>
+constexpr size_t leb128_size(const type_t& value) noexcept
+{
+    // zero value still takes a single byte
+
+    return std::max<size_t>((impl::bit_length(impl::to_varint_unsigned(value)) + 6) / 7, 1);
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+template<typename type_t, std::enable_if_t<is_long_integer_v<type_t>, int>>
+constexpr size_t prefix_varint_size(const type_t& value) noexcept
+{
+    const make_unsigned_t<type_t> unsigned_value = impl::to_varint_unsigned(value);
+
+    if (unsigned_value < make_unsigned_t<type_t>(impl::prefix_varint_direct_limit_v<type_t>))
+        return 1;
+
+    return 1 + (impl::bit_length(unsigned_value) + 7) / 8;
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+template<typename type_t, std::enable_if_t<is_long_integer_v<type_t>, int>>
+constexpr size_t prefix_varint_length(std::byte first_byte) noexcept
+{
+    const uint_t header = std::to_integer<uint_t>(first_byte);
+
+    return header < impl::prefix_varint_direct_limit_v<type_t> ? 1 : 1 + (256 - header);
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+template<typename type_t, std::enable_if_t<is_long_integer_v<type_t>, int>>
+constexpr size_t encode_leb128(const type_t& value, std::span<std::byte> bytes) noexcept
+{
+    const make_unsigned_t<type_t> unsigned_value = impl::to_varint_unsigned(value);
+    const size_t size = std::max<size_t>((impl::bit_length(unsigned_value) + 6) / 7, 1);
+
+    if (bytes.size() < size)
+        return 0;
+
+    // seven bits per byte starting from the least significant ones, high bit marks continuation
+
+    for (size_t n = 0; n < size; ++n) {
+
+        const uint_t group = impl::get_leb128_group(unsigned_value, static_cast<uint_t>(n * 7));
+        bytes[n] = std::byte(static_cast<uint8_t>(n + 1 < size ? group | 0x80 : group));
+    }
+
+    return size;
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+template<typename type_t, std::enable_if_t<is_long_integer_v<type_t>, int>>
+constexpr size_t encode_prefix_varint(const type_t& value, std::span<std::byte> bytes) noexcept
+{
+    using unsigned_t = make_unsigned_t<type_t>;
+
+    const unsigned_t unsigned_value = impl::to_varint_unsigned(value);
+
+    if (bytes.empty())
+        return 0;
+
+    // small values are stored in the first byte itself
+
+    if (unsigned_value < unsigned_t(impl::prefix_varint_direct_limit_v<type_t>)) {
+
+        bytes[0] = std::byte(static_cast<uint8_t>(unsigned_value.digits[0]));
+        return 1;
+    }
+
+    // otherwise the first byte encodes number of following little-endian bytes
+
+    const size_t value_size = (impl::bit_length(unsigned_value) + 7) / 8;
+
+    if (bytes.size() < value_size + 1)
+        return 0;
+
+    std::array<std::byte, byte_count_v<unsigned_t>> buffer;
+    to_bytes_le(unsigned_value, buffer);
+
+    bytes[0] = std::byte(static_cast<uint8_t>(256 - value_size));
+    std::copy_n(buffer.begin(), value_size, bytes.begin() + 1);
+
+    return value_size + 1;
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+template<typename type_t, std::enable_if_t<is_long_integer_v<type_t>, int>>
+constexpr size_t decode_leb128(std::span<const std::byte> bytes, type_t& value) noexcept
+{
+    using unsigned_t = make_unsigned_t<type_t>;
+
+    constexpr uint_t value_bits = bit_count_v<unsigned_t>;
+
+    unsigned_t result = 0U;
+
+    for (size_t n = 0; n < bytes.size() && n < leb128_max_size_v<type_t>; ++n) {
+
+        const uint_t byte = std::to_integer<uint_t>(bytes[n]);
+        const uint_t group = byte & 0x7f;
+        const uint_t position = static_cast<uint_t>(n * 7);
+
+        // the last group may have bits above the type width, which must be zeros
+
+        if (position + 7 > value_bits && (group >> (value_bits - position)) != 0)
+            return 0;
+
+        impl::put_leb128_group(result, position, group);
+
+        if ((byte & 0x80) == 0) {
+
+            value = impl::from_varint_unsigned<type_t>(result);
+            return n + 1;
+        }
+    }
+
+    return 0;
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+template<typename type_t, std::enable_if_t<is_long_integer_v<type_t>, int>>
+constexpr size_t decode_prefix_varint(std::span<const std::byte> bytes, type_t& value) noexcept
+{
+    using unsigned_t = make_unsigned_t<type_t>;
+
+    if (bytes.empty())
+        return 0;
+
+    const size_t size = prefix_varint_length<type_t>(bytes[0]);
+
+    if (size == 1) {
+
+        value = impl::from_varint_unsigned<type_t>(unsigned_t(std::to_integer<uint_t>(bytes[0])));
+        return 1;
+    }
+
+    if (bytes.size() < size)
+        return 0;
+
+    // the rest of bytes are implicit zeros
+
+    std::array<std::byte, byte_count_v<unsigned_t>> buffer{};
+    std::copy_n(bytes.begin() + 1, size - 1, buffer.begin());
+
+    value = impl::from_varint_unsigned<type_t>(from_bytes_le<unsigned_t>(buffer));
+
+    return size;
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+template<typename type_t, size_t extent, std::enable_if_t<is_long_integer_v<std::remove_const_t<type_t>>, int>>
+constexpr size_t encode_leb128(std::span<type_t, extent> values, std::span<std::byte> bytes) noexcept
+{
+    size_t offset = 0;
+
+    for (const auto& value : values) {
+
+        const size_t size = encode_leb128(value, bytes.subspan(offset));
+
+        if (size == 0)
+            return 0;
+
+        offset += size;
+    }
+
+    return offset;
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+template<typename type_t, size_t extent, std::enable_if_t<is_long_integer_v<std::remove_const_t<type_t>>, int>>
+constexpr size_t encode_prefix_varint(std::span<type_t, extent> values, std::span<std::byte> bytes) noexcept
+{
+    size_t offset = 0;
+
+    for (const auto& value : values) {
+
+        const size_t size = encode_prefix_varint(value, bytes.subspan(offset));
+
+        if (size == 0)
+            return 0;
+
+        offset += size;
+    }
+
+    return offset;
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+template<typename type_t, size_t extent, std::enable_if_t<is_long_integer_v<type_t>, int>>
+constexpr size_t decode_leb128(std::span<const std::byte> bytes, std::span<type_t, extent> values) noexcept
+{
+    size_t offset = 0;
+
+    for (type_t& value : values) {
+
+        const size_t size = decode_leb128(bytes.subspan(offset), value);
+
+        if (size == 0)
+            return 0;
+
+        offset += size;
+    }
+
+    return offset;
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+template<typename type_t, size_t extent, std::enable_if_t<is_long_integer_v<type_t>, int>>
+constexpr size_t decode_prefix_varint(std::span<const std::byte> bytes, std::span<type_t, extent> values) noexcept
+{
+    size_t offset = 0;
+
+    for (type_t& value : values) {
+
+        const size_t size = decode_prefix_varint(bytes.subspan(offset), value);
+
+        if (size == 0)
+            return 0;
+
+        offset += size;
+    }
+
+    return offset;
+}
+
+namespace impl
+{
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// standalone helper methods
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+template<typename type_t>
+constexpr make_unsigned_t<type_t> to_varint_unsigned(const type_t& value) noexcept
+{
+    if constexpr (is_signed_v<type_t>)
+        return zigzag_encode(value);
+    else
+        return value;
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+template<typename type_t>
+constexpr type_t from_varint_unsigned(const make_unsigned_t<type_t>& value) noexcept
+{
+    if constexpr (is_signed_v<type_t>)
+        return zigzag_decode(value);
+    else
+        return value;
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+template<typename native_t, uint_t size>
+constexpr uint_t bit_length(const long_uint_t<native_t, size>& value) noexcept
+{
+    return bit_count_v<long_uint_t<native_t, size>> - nlz(value);
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+template<typename native_t, uint_t size>
+constexpr uint_t get_leb128_group(const long_uint_t<native_t, size>& value, uint_t position) noexcept
+{
+    constexpr uint_t native_bits = bit_count_v<native_t>;
+
+    const uint_t index = position / native_bits;
+    const uint_t offset = position % native_bits;
+
+    // a group may span two native digits
+
+    uint_t group = static_cast<uint_t>(value.digits[index] >> offset);
+
+    if (offset + 7 > native_bits && index + 1 < size)
+        group |= static_cast<uint_t>(value.digits[index + 1] << (native_bits - offset));
+
+    return group & 0x7f;
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+template<typename native_t, uint_t size>
+constexpr void put_leb128_group(long_uint_t<native_t, size>& value, uint_t position, uint_t group) noexcept
+{
+    constexpr uint_t native_bits = bit_count_v<native_t>;
+
+    const uint_t index = position / native_bits;
+    const uint_t offset = position % native_bits;
+
+    value.digits[index] |= static_cast<native_t>(static_cast<native_t>(group) << offset);
+
+    if (offset + 7 > native_bits && index + 1 < size)
+        value.digits[index + 1] |= static_cast<native_t>(group >> (native_bits - offset));
+}
+
+} // namespace impl
+} // namespace slim
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// End of long_varint.h
+////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,769 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// Simple Long Integer Math for C++
+// version 2.0
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// Licensed under the MIT License <http://opensource.org/licenses/MIT>.
+// SPDX-License-Identifier: MIT
+//
+// Copyright (c) 2020-2026 Yury Kalmykov <y_kalmykov@mail.ru>.
+//
+// Permission is hereby  granted, free of charge, to any  person obtaining a copy
+// of this software and associated  documentation files (the "Software"), to deal
+// in the Software  without restriction, including without  limitation the rights
+// to  use, copy,  modify, merge,  publish, distribute,  sublicense, and/or  sell
+// copies  of  the Software,  and  to  permit persons  to  whom  the Software  is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE  IS PROVIDED "AS  IS", WITHOUT WARRANTY  OF ANY KIND,  EXPRESS OR
+// IMPLIED,  INCLUDING BUT  NOT  LIMITED TO  THE  WARRANTIES OF  MERCHANTABILITY,
+// FITNESS FOR  A PARTICULAR PURPOSE AND  NONINFRINGEMENT. IN NO EVENT  SHALL THE
+// AUTHORS  OR COPYRIGHT  HOLDERS  BE  LIABLE FOR  ANY  CLAIM,  DAMAGES OR  OTHER
+// LIABILITY, WHETHER IN AN ACTION OF  CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE  OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+#pragma once
+
+#include "long_bytes.h"
+#include "long_uint.h"
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <compare>
+#include <cstddef>
+#include <iterator>
+#include <ranges>
+#include <span>
+
+namespace slim
+{
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// long_uint_view class
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+template<typename type_t>
+class long_uint_view
+{
+public:
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    // type and constant definition
+
+    using value_type = type_t;
+    using native_t = typename type_t::native_array_t::value_type;
+
+    static constexpr uint_t size = std::tuple_size_v<typename type_t::native_array_t>;
+
+    static_assert(is_long_integer_v<type_t> && is_unsigned_v<type_t>, "view value type must be unsigned long integer.");
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    // construction/destruction
+
+    constexpr long_uint_view() noexcept = default;
+    constexpr long_uint_view(const long_uint_view& that) noexcept = default;
+    explicit constexpr long_uint_view(const std::byte* data) noexcept;
+    explicit constexpr long_uint_view(std::span<const std::byte, byte_count_v<type_t>> bytes) noexcept;
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    // public methods
+
+    constexpr long_uint_view& operator=(const long_uint_view& that) noexcept = default;
+
+    constexpr const std::byte* data() const noexcept;
+    constexpr native_t digit(uint_t index) const noexcept;
+    constexpr type_t load() const noexcept;
+    constexpr operator type_t() const noexcept;
+    constexpr bool operator==(const long_uint_view& that) const noexcept;
+    constexpr bool operator==(const type_t& that) const noexcept;
+    constexpr std::strong_ordering operator<=>(const long_uint_view& that) const noexcept;
+    constexpr std::strong_ordering operator<=>(const type_t& that) const noexcept;
+    constexpr type_t operator<<(uint_t shift) const noexcept;
+    constexpr type_t operator>>(uint_t shift) const noexcept;
+    constexpr type_t operator~() const noexcept;
+    constexpr type_t operator-() const noexcept;
+
+private:
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    // data members
+
+    const std::byte* ptr = nullptr;
+};
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// long_uint_view_range class
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+template<typename type_t>
+class long_uint_view_range : public std::ranges::view_interface<long_uint_view_range<type_t>>
+{
+public:
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    // type and constant definition
+
+    class iterator;
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    // construction/destruction
+
+    constexpr long_uint_view_range() noexcept = default;
+    constexpr long_uint_view_range(const long_uint_view_range& that) noexcept = default;
+    explicit constexpr long_uint_view_range(std::span<const std::byte> bytes) noexcept;
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    // public methods
+
+    constexpr long_uint_view_range& operator=(const long_uint_view_range& that) noexcept = default;
+
+    constexpr iterator begin() const noexcept;
+    constexpr iterator end() const noexcept;
+    constexpr size_t size() const noexcept;
+
+private:
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    // data members
+
+    std::span<const std::byte> bytes;
+};
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// long_uint_view_range::iterator class
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+template<typename type_t>
+class long_uint_view_range<type_t>::iterator
+{
+public:
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    // type and constant definition
+
+    using iterator_concept = std::random_access_iterator_tag;
+    using iterator_category = std::input_iterator_tag;
+    using value_type = type_t;
+    using difference_type = std::ptrdiff_t;
+    using reference = long_uint_view<type_t>;
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    // construction/destruction
+
+    constexpr iterator() noexcept = default;
+    constexpr iterator(const iterator& that) noexcept = default;
+    explicit constexpr iterator(const std::byte* data) noexcept;
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    // public methods
+
+    constexpr iterator& operator=(const iterator& that) noexcept = default;
+
+    constexpr reference operator*() const noexcept;
+    constexpr reference operator[](difference_type offset) const noexcept;
+    constexpr iterator& operator++() noexcept;
+    constexpr iterator operator++(int) noexcept;
+    constexpr iterator& operator--() noexcept;
+    constexpr iterator operator--(int) noexcept;
+    constexpr iterator& operator+=(difference_type offset) noexcept;
+    constexpr iterator& operator-=(difference_type offset) noexcept;
+    constexpr iterator operator+(difference_type offset) const noexcept;
+    constexpr iterator operator-(difference_type offset) const noexcept;
+    constexpr difference_type operator-(const iterator& that) const noexcept;
+    constexpr bool operator==(const iterator& that) const noexcept;
+    constexpr std::strong_ordering operator<=>(const iterator& that) const noexcept;
+
+    friend constexpr iterator operator+(difference_type offset, const iterator& that) noexcept
+    {
+        return that + offset;
+    }
+
+private:
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    // data members
+
+    const std::byte* ptr = nullptr;
+};
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// type traits
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+template<typename type_t>
+constexpr bool is_long_uint_view_v = false;
+template<typename type_t>
+constexpr bool is_long_uint_view_v<long_uint_view<type_t>> = true;
+
+namespace impl
+{
+
+template<typename type_t>
+struct view_value
+{
+    using type = void;
+};
+
+template<typename type_t>
+struct view_value<long_uint_view<type_t>>
+{
+    using type = type_t;
+};
+
+template<typename type_t>
+using view_value_t = typename view_value<type_t>::type;
+
+template<typename left_t, typename right_t>
+using view_operands_value_t = std::conditional_t<is_long_uint_view_v<left_t>, view_value_t<left_t>, view_value_t<right_t>>;
+
+} // namespace impl
+
+template<typename left_t, typename right_t>
+constexpr bool is_view_operands_v = (is_long_uint_view_v<left_t> && std::is_convertible_v<right_t, impl::view_value_t<left_t>>) ||
+    (is_long_uint_view_v<right_t> && std::is_convertible_v<left_t, impl::view_value_t<right_t>>);
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// standalone methods
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+// iterate packed little-endian integers without copying or alignment requirements
+
+template<typename type_t, std::enable_if_t<is_long_integer_v<type_t> && is_unsigned_v<type_t>, int> = 0>
+constexpr long_uint_view_range<type_t> as_long_uints(std::span<const std::byte> bytes) noexcept;
+
+// view operators, loading operands and returning value type
+
+template<typename left_t, typename right_t, std::enable_if_t<is_view_operands_v<left_t, right_t>, int> = 0>
+constexpr auto operator+(const left_t& left, const right_t& right) noexcept;
+template<typename left_t, typename right_t, std::enable_if_t<is_view_operands_v<left_t, right_t>, int> = 0>
+constexpr auto operator-(const left_t& left, const right_t& right) noexcept;
+template<typename left_t, typename right_t, std::enable_if_t<is_view_operands_v<left_t, right_t>, int> = 0>
+constexpr auto operator*(const left_t& left, const right_t& right) noexcept;
+template<typename left_t, typename right_t, std::enable_if_t<is_view_operands_v<left_t, right_t>, int> = 0>
+constexpr auto operator/(const left_t& left, const right_t& right) noexcept;
+template<typename left_t, typename right_t, std::enable_if_t<is_view_operands_v<left_t, right_t>, int> = 0>
+constexpr auto operator%(const left_t& left, const right_t& right) noexcept;
+template<typename left_t, typename right_t, std::enable_if_t<is_view_operands_v<left_t, right_t>, int> = 0>
+constexpr auto operator&(const left_t& left, const right_t& right) noexcept;
+template<typename left_t, typename right_t, std::enable_if_t<is_view_operands_v<left_t, right_t>, int> = 0>
+constexpr auto operator|(const left_t& left, const right_t& right) noexcept;
+template<typename left_t, typename right_t, std::enable_if_t<is_view_operands_v<left_t, right_t>, int> = 0>
+constexpr auto operator^(const left_t& left, const right_t& right) noexcept;
+
+namespace impl
+{
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// standalone helper methods
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+template<typename native_t>
+constexpr native_t load_digit_le(const std::byte* data) noexcept;
+
+} // namespace impl
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// long_uint_view class
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// construction/destruction
+
+template<typename type_t>
+constexpr long_uint_view<type_t>::long_uint_view(const std::byte* data) noexcept
+: ptr(data)
+{
+}
+
+template<typename type_t>
+constexpr long_uint_view<type_t>::long_uint_view(std::span<const std::byte, byte_count_v<type_t>> bytes) noexcept
+: ptr(bytes.data())
+{
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// public methods
+
+template<typename type_t>
+constexpr const std::byte* long_uint_view<type_t>::data() const noexcept
+{
+    return ptr;
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+template<typename type_t>
+constexpr typename long_uint_view<type_t>::native_t long_uint_view<type_t>::digit(uint_t index) const noexcept
+{
+    assert(index < size);
+
+    return impl::load_digit_le<native_t>(ptr + index * sizeof(native_t));
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+template<typename type_t>
+constexpr type_t long_uint_view<type_t>::load() const noexcept
+{
+    type_t result;
+
+    for (uint_t n = 0; n < size; ++n)
+        result.digits[n] = digit(n);
+
+    return result;
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+template<typename type_t>
+constexpr long_uint_view<type_t>::operator type_t() const noexcept
+{
+    return load();
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+template<typename type_t>
+constexpr bool long_uint_view<type_t>::operator==(const long_uint_view& that) const noexcept
+{
+    // stop at the first different digit, without loading the rest
+
+    for (uint_t n = 0; n < size; ++n) {
+
+        if (digit(n) != that.digit(n))
+            return false;
+    }
+
+    return true;
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+template<typename type_t>
+constexpr bool long_uint_view<type_t>::operator==(const type_t& that) const noexcept
+{
+    for (uint_t n = 0; n < size; ++n) {
+
+        if (digit(n) != that.digits[n])
+            return false;
+    }
+
+    return true;
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+template<typename type_t>
+constexpr std::strong_ordering long_uint_view<type_t>::operator<=>(const long_uint_view& that) const noexcept
+{
+    // the most significant different digit decides, which is usually the first loaded one
+
+    for (uint_t n = size; n > 0; --n) {
+
+        const native_t value1 = digit(n - 1);
+        const native_t value2 = that.digit(n - 1);
+
+        if (value1 != value2)
+            return value1 <=> value2;
+    }
+
+    return std::strong_ordering::equal;
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+template<typename type_t>
+constexpr std::strong_ordering long_uint_view<type_t>::operator<=>(const type_t& that) const noexcept
+{
+    for (uint_t n = size; n > 0; --n) {
+
+        const native_t value = digit(n - 1);
+
+        if (value != that.digits[n - 1])
+            return value <=> that.digits[n - 1];
+    }
+
+    return std::strong_ordering::equal;
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+template<typename type_t>
+constexpr type_t long_uint_view<type_t>::operator<<(uint_t shift) const noexcept
+{
+    return load() << shift;
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+template<typename type_t>
+constexpr type_t long_uint_view<type_t>::operator>>(uint_t shift) const noexcept
+{
+    return load() >> shift;
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+template<typename type_t>
+constexpr type_t long_uint_view<type_t>::operator~() const noexcept
+{
+    return ~load();
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+template<typename type_t>
+constexpr type_t long_uint_view<type_t>::operator-() const noexcept
+{
+    return -load();
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// long_uint_view_range class
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// construction/destruction
+
+template<typename type_t>
+constexpr long_uint_view_range<type_t>::long_uint_view_range(std::span<const std::byte> bytes) noexcept
+: bytes(bytes.first(bytes.size() - bytes.size() % byte_count_v<type_t>))
+{
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// public methods
+
+template<typename type_t>
+constexpr typename long_uint_view_range<type_t>::iterator long_uint_view_range<type_t>::begin() const noexcept
+{
+    return iterator(bytes.data());
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+template<typename type_t>
+constexpr typename long_uint_view_range<type_t>::iterator long_uint_view_range<type_t>::end() const noexcept
+{
+    return iterator(bytes.data() + bytes.size());
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+template<typename type_t>
+constexpr size_t long_uint_view_range<type_t>::size() const noexcept
+{
+    return bytes.size() / byte_count_v<type_t>;
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// long_uint_view_range::iterator class
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// construction/destruction
+
+template<typename type_t>
+constexpr long_uint_view_range<type_t>::iterator::iterator(const std::byte* data) noexcept
+: ptr(data)
+{
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// public methods
+
+template<typename type_t>
+constexpr typename long_uint_view_range<type_t>::iterator::reference long_uint_view_range<type_t>::iterator::operator*() const noexcept
+{
+    return reference(ptr);
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+template<typename type_t>
+constexpr typename long_uint_view_range<type_t>::iterator::reference long_uint_view_range<type_t>::iterator::operator[](difference_type offset) const noexcept
+{
+    return *(*this + offset);
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+template<typename type_t>
+constexpr typename long_uint_view_range<type_t>::iterator& long_uint_view_range<type_t>::iterator::operator++() noexcept
+{
+    ptr += byte_count_v<type_t>;
+
+    return *this;
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+template<typename type_t>
+constexpr typename long_uint_view_range<type_t>::iterator long_uint_view_range<type_t>::iterator::operator++(int) noexcept
+{
+    iterator result = *this;
+    ++*this;
+
+    return result;
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+template<typename type_t>
+constexpr typename long_uint_view_range<type_t>::iterator& long_uint_view_range<type_t>::iterator::operator--() noexcept
+{
+    ptr -= byte_count_v<type_t>;
+
+    return *this;
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+template<typename type_t>
+constexpr typename long_uint_view_range<type_t>::iterator long_uint_view_range<type_t>::iterator::operator--(int) noexcept
+{
+    iterator result = *this;
+    --*this;
+
+    return result;
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+template<typename type_t>
+constexpr typename long_uint_view_range<type_t>::iterator& long_uint_view_range<type_t>::iterator::operator+=(difference_type offset) noexcept
+{
+    ptr += offset * static_cast<difference_type>(byte_count_v<type_t>);
+
+    return *this;
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+template<typename type_t>
+constexpr typename long_uint_view_range<type_t>::iterator& long_uint_view_range<type_t>::iterator::operator-=(difference_type offset) noexcept
+{
+    ptr -= offset * static_cast<difference_type>(byte_count_v<type_t>);
+
+    return *this;
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+template<typename type_t>
+constexpr typename long_uint_view_range<type_t>::iterator long_uint_view_range<type_t>::iterator::operator+(difference_type offset) const noexcept
+{
+    iterator result = *this;
+
+    return result += offset;
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+template<typename type_t>
+constexpr typename long_uint_view_range<type_t>::iterator long_uint_view_range<type_t>::iterator::operator-(difference_type offset) const noexcept
+{
+    iterator result = *this;
+
+    return result -= offset;
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+template<typename type_t>
+constexpr typename long_uint_view_range<type_t>::iterator::difference_type long_uint_view_range<type_t>::iterator::operator-(const iterator& that) const noexcept
+{
+    return (ptr - that.ptr) / static_cast<difference_type>(byte_count_v<type_t>);
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+template<typename type_t>
+constexpr bool long_uint_view_range<type_t>::iterator::operator==(const iterator& that) const noexcept
+{
+    return ptr == that.ptr;
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+template<typename type_t>
+constexpr std::strong_ordering long_uint_view_range<type_t>::iterator::operator<=>(const iterator& that) const noexcept
+{
+    return ptr <=> that.ptr;
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// standalone methods
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+template<typename type_t, std::enable_if_t<is_long_integer_v<type_t> && is_unsigned_v<type_t>, int>>
+constexpr long_uint_view_range<type_t> as_long_uints(std::span<const std::byte> bytes) noexcept
+{
+    return long_uint_view_range<type_t>(bytes);
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+template<typename left_t, typename right_t, std::enable_if_t<is_view_operands_v<left_t, right_t>, int>>
+constexpr auto operator+(const left_t& left, const right_t& right) noexcept
+{
+    using value_t = impl::view_operands_value_t<left_t, right_t>;
+
+    return value_t(left) + value_t(right);
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+template<typename left_t, typename right_t, std::enable_if_t<is_view_operands_v<left_t, right_t>, int>>
+constexpr auto operator-(const left_t& left, const right_t& right) noexcept
+{
+    using value_t = impl::view_operands_value_t<left_t, right_t>;
+
+    return value_t(left) - value_t(right);
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+template<typename left_t, typename right_t, std::enable_if_t<is_view_operands_v<left_t, right_t>, int>>
+constexpr auto operator*(const left_t& left, const right_t& right) noexcept
+{
+    using value_t = impl::view_operands_value_t<left_t, right_t>;
+
+    return value_t(left) * value_t(right);
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+template<typename left_t, typename right_t, std::enable_if_t<is_view_operands_v<left_t, right_t>, int>>
+constexpr auto operator/(const left_t& left, const right_t& right) noexcept
+{
+    using value_t = impl::view_operands_value_t<left_t, right_t>;
+
+    return value_t(left) / value_t(right);
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+template<typename left_t, typename right_t, std::enable_if_t<is_view_operands_v<left_t, right_t>, int>>
+constexpr auto operator%(const left_t& left, const right_t& right) noexcept
+{
+    using value_t = impl::view_operands_value_t<left_t, right_t>;
+
+    return value_t(left) % value_t(right);
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+template<typename left_t, typename right_t, std::enable_if_t<is_view_operands_v<left_t, right_t>, int>>
+constexpr auto operator&(const left_t& left, const right_t& right) noexcept
+{
+    using value_t = impl::view_operands_value_t<left_t, right_t>;
+
+    return value_t(left) & value_t(right);
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+template<typename left_t, typename right_t, std::enable_if_t<is_view_operands_v<left_t, right_t>, int>>
+constexpr auto operator|(const left_t& left, const right_t& right) noexcept
+{
+    using value_t = impl::view_operands_value_t<left_t, right_t>;
+
+    return value_t(left) | value_t(right);
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+template<typename left_t, typename right_t, std::enable_if_t<is_view_operands_v<left_t, right_t>, int>>
+constexpr auto operator^(const left_t& left, const right_t& right) noexcept
+{
+    using value_t = impl::view_operands_value_t<left_t, right_t>;
+
+    return value_t(left) ^ value_t(right);
+}
+
+namespace impl
+{
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// standalone helper methods
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+template<typename native_t>
+constexpr native_t load_digit_le(const std::byte* data) noexcept
+{
+    // bytewise copy is compiled into a single unaligned load
+
+    std::array<std::byte, sizeof(native_t)> buffer;
+    std::copy_n(data, sizeof(native_t), buffer.begin());
+
+    const native_t digit = std::bit_cast<native_t>(buffer);
+
+    if constexpr (std::endian::native == std::endian::little)
+        return digit;
+    else
+        return byte_swap(digit);
+}
+
+} // namespace impl
+} // namespace slim
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// End of long_view.h
+////////////////////////////////////////////////////////////////////////////////////////////////////
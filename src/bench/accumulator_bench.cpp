@@ -0,0 +1,170 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// Simple Long Integer Math for C++
+// version 2.0
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// Licensed under the MIT License <http://opensource.org/licenses/MIT>.
+// SPDX-License-Identifier: MIT
+//
+// Copyright (c) 2026 Yury Kalmykov <y_kalmykov@mail.ru>.
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+#include "bench_helpers.h"
+
+#include <slimcpplib/long_accumulator.h>
+
+#include <algorithm>
+#include <benchmark/benchmark.h>
+#include <chrono>
+#include <random>
+#include <span>
+#include <vector>
+
+namespace
+{
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// constants
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+constexpr size_t values_per_iteration = 1 << 16;
+
+enum class method_t
+{
+    long_addition,
+    accumulator_addition,
+    accumulator_span,
+};
+
+enum class dot_method_t
+{
+    long_multiplication,
+    exact,
+};
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// standalone functions
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+std::vector<int64_t> make_native_values(size_t count)
+{
+    std::mt19937_64 engine(0x5eed);
+    std::vector<int64_t> values(count);
+
+    for (int64_t& value : values)
+        value = static_cast<int64_t>(engine());
+
+    return values;
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+template<typename type_t, method_t method>
+void bench_accumulate(benchmark::State& state)
+{
+    const std::vector<int64_t> values = make_native_values(values_per_iteration);
+
+    for (auto _ : state) {
+
+        const auto started_at = std::chrono::steady_clock::now();
+
+        type_t sum;
+
+        if constexpr (method == method_t::long_addition) {
+
+            // carry ripples through all digits of every addition
+
+            sum = 0;
+
+            for (int64_t value : values)
+                sum += type_t(value);
+
+        } else if constexpr (method == method_t::accumulator_addition) {
+
+            slim::accumulator<type_t> result;
+
+            for (int64_t value : values)
+                result += value;
+
+            sum = result.value();
+
+        } else
+            sum = slim::accumulate<type_t>(std::span<const int64_t>(values));
+
+        const auto finished_at = std::chrono::steady_clock::now();
+        const double elapsed_seconds = std::chrono::duration<double>(finished_at - started_at).count();
+
+        benchmark::DoNotOptimize(sum);
+        state.SetIterationTime(elapsed_seconds);
+    }
+
+    state.SetItemsProcessed(state.iterations() * values_per_iteration);
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+template<dot_method_t method>
+void bench_dot(benchmark::State& state)
+{
+    const std::vector<int64_t> values1 = make_native_values(values_per_iteration);
+    std::vector<int64_t> values2 = make_native_values(values_per_iteration);
+    std::reverse(values2.begin(), values2.end());
+
+    for (auto _ : state) {
+
+        const auto started_at = std::chrono::steady_clock::now();
+
+        if constexpr (method == dot_method_t::long_multiplication) {
+
+            // products of int128_t overflow sums of more than two products of large values
+
+            int128_t sum = 0;
+
+            for (size_t n = 0; n < values1.size(); ++n)
+                sum += int128_t(values1[n]) * int128_t(values2[n]);
+
+            benchmark::DoNotOptimize(sum);
+
+        } else {
+
+            const int256_t sum = slim::dot_exact(std::span<const int64_t>(values1), std::span<const int64_t>(values2));
+
+            benchmark::DoNotOptimize(sum);
+        }
+
+        const auto finished_at = std::chrono::steady_clock::now();
+        const double elapsed_seconds = std::chrono::duration<double>(finished_at - started_at).count();
+
+        state.SetIterationTime(elapsed_seconds);
+    }
+
+    state.SetItemsProcessed(state.iterations() * values_per_iteration);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// Benchmarks entry points
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#define BENCHMARK_FOR_ACCUMULATOR_TYPES(function_name, ...) \
+    BENCHMARK_TEMPLATE(function_name, int128_t __VA_OPT__(,) __VA_ARGS__)->UseManualTime()->Iterations(200); \
+    BENCHMARK_TEMPLATE(function_name, int256_t __VA_OPT__(,) __VA_ARGS__)->UseManualTime()->Iterations(200)
+
+BENCHMARK_FOR_ACCUMULATOR_TYPES(bench_accumulate, method_t::long_addition);
+BENCHMARK_FOR_ACCUMULATOR_TYPES(bench_accumulate, method_t::accumulator_addition);
+BENCHMARK_FOR_ACCUMULATOR_TYPES(bench_accumulate, method_t::accumulator_span);
+BENCHMARK_TEMPLATE(bench_dot, dot_method_t::long_multiplication)->UseManualTime()->Iterations(200);
+BENCHMARK_TEMPLATE(bench_dot, dot_method_t::exact)->UseManualTime()->Iterations(200);
+
+#undef BENCHMARK_FOR_ACCUMULATOR_TYPES
+} // namespace
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// End of file accumulator_bench.cpp
+////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -17,8 +17,41 @@
 #include "type_sets.h"
 
 #include <cstddef>
+#include <random>
 #include <tuple>
+#include <vector>
 
 namespace slim::bench
 {
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// standalone functions
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+template<typename type_t>
+std::vector<type_t> make_random_values(size_t count, uint64_t seed = 0x5eed);
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+template<typename type_t>
+std::vector<type_t> make_random_values(size_t count, uint64_t seed)
+{
+    using native_t = native_word_t<type_t>;
+
+    std::mt19937_64 engine(seed);
+    std::vector<type_t> values(count);
+
+    for (type_t& value : values) {
+
+        typename type_t::native_array_t digits{};
+
+        for (native_t& digit : digits)
+            digit = static_cast<native_t>(engine());
+
+        value = type_t(digits);
+    }
+
+    return values;
+}
+
 } // namespace slim::bench
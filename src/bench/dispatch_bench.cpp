@@ -0,0 +1,190 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// Simple Long Integer Math for C++
+// version 2.0
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// Licensed under the MIT License <http://opensource.org/licenses/MIT>.
+// SPDX-License-Identifier: MIT
+//
+// Copyright (c) 2026 Yury Kalmykov <y_kalmykov@mail.ru>.
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+#include "bench_helpers.h"
+
+#include <slimcpplib/long_dispatch.h>
+
+#include <array>
+#include <benchmark/benchmark.h>
+#include <chrono>
+#include <string>
+#include <vector>
+
+namespace
+{
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// constants
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+constexpr size_t values_per_iteration = 1024;
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// standalone functions
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+template<typename type_t>
+void set_dispatch_label(benchmark::State& state, const slim::dispatch_table_t<type_t>& table)
+{
+    // requested level may be lowered to the detected one
+
+    state.SetLabel(std::string(slim::isa_name(table.level)));
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+template<typename type_t, slim::isa_t level>
+void bench_dispatch_mul(benchmark::State& state)
+{
+    const slim::dispatch_table_t<type_t> table = slim::make_dispatch_table<type_t>(level);
+    const std::vector<type_t> values1 = slim::bench::make_random_values<type_t>(values_per_iteration, 1);
+    const std::vector<type_t> values2 = slim::bench::make_random_values<type_t>(values_per_iteration, 2);
+    type_t result = 0U;
+
+    for (auto _ : state) {
+
+        const auto started_at = std::chrono::steady_clock::now();
+
+        for (size_t n = 0; n < values_per_iteration; ++n)
+            result ^= table.mul(values1[n], values2[n]);
+
+        const auto finished_at = std::chrono::steady_clock::now();
+        const double elapsed_seconds = std::chrono::duration<double>(finished_at - started_at).count();
+
+        benchmark::DoNotOptimize(result);
+        state.SetIterationTime(elapsed_seconds);
+    }
+
+    state.SetItemsProcessed(state.iterations() * values_per_iteration);
+    set_dispatch_label(state, table);
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+template<typename type_t, slim::isa_t level>
+void bench_dispatch_div(benchmark::State& state)
+{
+    const slim::dispatch_table_t<type_t> table = slim::make_dispatch_table<type_t>(level);
+    const std::vector<type_t> values1 = slim::bench::make_random_values<type_t>(values_per_iteration, 1);
+    std::vector<type_t> values2 = slim::bench::make_random_values<type_t>(values_per_iteration, 2);
+    type_t result = 0U;
+
+    // divisors are half as long as dividends
+
+    for (type_t& value : values2)
+        value = (value >> (slim::bit_count_v<type_t> / 2)) | type_t(1U);
+
+    for (auto _ : state) {
+
+        const auto started_at = std::chrono::steady_clock::now();
+
+        for (size_t n = 0; n < values_per_iteration; ++n)
+            result ^= table.div(values1[n], values2[n]);
+
+        const auto finished_at = std::chrono::steady_clock::now();
+        const double elapsed_seconds = std::chrono::duration<double>(finished_at - started_at).count();
+
+        benchmark::DoNotOptimize(result);
+        state.SetIterationTime(elapsed_seconds);
+    }
+
+    state.SetItemsProcessed(state.iterations() * values_per_iteration);
+    set_dispatch_label(state, table);
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+template<typename type_t, slim::isa_t level>
+void bench_dispatch_add_n(benchmark::State& state)
+{
+    const slim::dispatch_table_t<type_t> table = slim::make_dispatch_table<type_t>(level);
+    const std::vector<type_t> values1 = slim::bench::make_random_values<type_t>(values_per_iteration, 1);
+    const std::vector<type_t> values2 = slim::bench::make_random_values<type_t>(values_per_iteration, 2);
+    std::vector<type_t> results(values_per_iteration);
+
+    for (auto _ : state) {
+
+        const auto started_at = std::chrono::steady_clock::now();
+
+        table.add_n(results, values1, values2);
+
+        const auto finished_at = std::chrono::steady_clock::now();
+        const double elapsed_seconds = std::chrono::duration<double>(finished_at - started_at).count();
+
+        benchmark::DoNotOptimize(results.data());
+        state.SetIterationTime(elapsed_seconds);
+    }
+
+    state.SetItemsProcessed(state.iterations() * values_per_iteration);
+    set_dispatch_label(state, table);
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+template<typename type_t, slim::isa_t level>
+void bench_dispatch_to_chars(benchmark::State& state)
+{
+    const slim::dispatch_table_t<type_t> table = slim::make_dispatch_table<type_t>(level);
+    const std::vector<type_t> values = slim::bench::make_random_values<type_t>(values_per_iteration);
+    std::array<char, slim::bit_count_v<type_t> + 1> buffer;
+    size_t length = 0;
+
+    for (auto _ : state) {
+
+        const auto started_at = std::chrono::steady_clock::now();
+
+        for (const type_t& value : values)
+            length += static_cast<size_t>(table.to_chars(buffer.data(), buffer.data() + buffer.size(), value, 10).ptr - buffer.data());
+
+        const auto finished_at = std::chrono::steady_clock::now();
+        const double elapsed_seconds = std::chrono::duration<double>(finished_at - started_at).count();
+
+        benchmark::DoNotOptimize(length);
+        state.SetIterationTime(elapsed_seconds);
+    }
+
+    state.SetItemsProcessed(state.iterations() * values_per_iteration);
+    set_dispatch_label(state, table);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// Benchmarks entry points
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#define BENCHMARK_FOR_DISPATCH_LEVELS(function_name) \
+    BENCHMARK_TEMPLATE(function_name, uint128_t, slim::isa_t::baseline)->UseManualTime()->Iterations(200); \
+    BENCHMARK_TEMPLATE(function_name, uint128_t, slim::isa_t::avx2)->UseManualTime()->Iterations(200); \
+    BENCHMARK_TEMPLATE(function_name, uint128_t, slim::isa_t::avx512ifma)->UseManualTime()->Iterations(200); \
+    BENCHMARK_TEMPLATE(function_name, uint256_t, slim::isa_t::baseline)->UseManualTime()->Iterations(200); \
+    BENCHMARK_TEMPLATE(function_name, uint256_t, slim::isa_t::avx2)->UseManualTime()->Iterations(200); \
+    BENCHMARK_TEMPLATE(function_name, uint256_t, slim::isa_t::avx512ifma)->UseManualTime()->Iterations(200)
+
+BENCHMARK_FOR_DISPATCH_LEVELS(bench_dispatch_mul);
+BENCHMARK_FOR_DISPATCH_LEVELS(bench_dispatch_div);
+BENCHMARK_FOR_DISPATCH_LEVELS(bench_dispatch_add_n);
+BENCHMARK_FOR_DISPATCH_LEVELS(bench_dispatch_to_chars);
+
+#undef BENCHMARK_FOR_DISPATCH_LEVELS
+} // namespace
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// End of file dispatch_bench.cpp
+////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,144 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// Simple Long Integer Math for C++
+// version 2.0
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// Licensed under the MIT License <http://opensource.org/licenses/MIT>.
+// SPDX-License-Identifier: MIT
+//
+// Copyright (c) 2026 Yury Kalmykov <y_kalmykov@mail.ru>.
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "bench_helpers.h"
+
+#include <slimcpplib/long_expr.h>
+
+#include <benchmark/benchmark.h>
+#include <chrono>
+
+namespace
+{
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// constants
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+constexpr size_t values_per_iteration = 1024;
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// expressions
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+struct mul_add_plain
+{
+    template<typename type_t>
+    type_t operator()(const type_t& a, const type_t& b, const type_t& c) const noexcept
+    {
+        return a * b + c;
+    }
+};
+
+struct mul_add_fused
+{
+    template<typename type_t>
+    type_t operator()(const type_t& a, const type_t& b, const type_t& c) const noexcept
+    {
+        return slim::expr::lazy(a) * b + c;
+    }
+};
+
+struct add_shr_plain
+{
+    template<typename type_t>
+    type_t operator()(const type_t& a, const type_t& b, const type_t&) const noexcept
+    {
+        return (a + b) >> 1;
+    }
+};
+
+struct add_shr_fused
+{
+    template<typename type_t>
+    type_t operator()(const type_t& a, const type_t& b, const type_t&) const noexcept
+    {
+        return (slim::expr::lazy(a) + b) >> 1;
+    }
+};
+
+struct mul_div_plain
+{
+    template<typename type_t>
+    type_t operator()(const type_t& a, const type_t& b, const type_t& c) const noexcept
+    {
+        return a * b / c;
+    }
+};
+
+struct mul_div_fused
+{
+    template<typename type_t>
+    type_t operator()(const type_t& a, const type_t& b, const type_t& c) const noexcept
+    {
+        return slim::expr::lazy(a) * b / c;
+    }
+};
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// standalone functions
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+template<typename type_t, typename expression_t>
+void bench_expression(benchmark::State& state)
+{
+    const std::vector<type_t> values1 = slim::bench::make_random_values<type_t>(values_per_iteration, 1);
+    const std::vector<type_t> values2 = slim::bench::make_random_values<type_t>(values_per_iteration, 2);
+    std::vector<type_t> values3 = slim::bench::make_random_values<type_t>(values_per_iteration, 3);
+    std::vector<type_t> results(values_per_iteration);
+
+    for (type_t& value : values3)
+        value |= type_t(1);
+
+    for (auto _ : state) {
+
+        const auto started_at = std::chrono::steady_clock::now();
+
+        for (size_t n = 0; n < values_per_iteration; ++n)
+            results[n] = expression_t()(values1[n], values2[n], values3[n]);
+
+        const auto finished_at = std::chrono::steady_clock::now();
+        const double elapsed_seconds = std::chrono::duration<double>(finished_at - started_at).count();
+
+        benchmark::DoNotOptimize(results.data());
+        state.SetIterationTime(elapsed_seconds);
+    }
+
+    state.SetItemsProcessed(state.iterations() * values_per_iteration);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// Benchmarks entry points
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#define BENCHMARK_FOR_EXPR_TYPES(expression_t) \
+    BENCHMARK_TEMPLATE(bench_expression, uint128_t, expression_t)->UseManualTime()->Iterations(1000); \
+    BENCHMARK_TEMPLATE(bench_expression, uint256_t, expression_t)->UseManualTime()->Iterations(1000)
+
+BENCHMARK_FOR_EXPR_TYPES(mul_add_plain);
+BENCHMARK_FOR_EXPR_TYPES(mul_add_fused);
+BENCHMARK_FOR_EXPR_TYPES(add_shr_plain);
+BENCHMARK_FOR_EXPR_TYPES(add_shr_fused);
+BENCHMARK_FOR_EXPR_TYPES(mul_div_plain);
+BENCHMARK_FOR_EXPR_TYPES(mul_div_fused);
+
+#undef BENCHMARK_FOR_EXPR_TYPES
+} // namespace
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// End of file expr_bench.cpp
+////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,141 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// Simple Long Integer Math for C++
+// version 2.0
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// Licensed under the MIT License <http://opensource.org/licenses/MIT>.
+// SPDX-License-Identifier: MIT
+//
+// Copyright (c) 2026 Yury Kalmykov <y_kalmykov@mail.ru>.
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+#include "bench_helpers.h"
+
+#include <slimcpplib/long_flat_map.h>
+
+#include <benchmark/benchmark.h>
+#include <chrono>
+#include <unordered_map>
+#include <vector>
+
+namespace
+{
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// constants
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+constexpr size_t values_per_iteration = 10'000'000;
+
+using flat_map_t = slim::flat_map<uint128_t, uint32_t>;
+using unordered_map_t = std::unordered_map<uint128_t, uint32_t>;
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// standalone functions
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void insert_key(flat_map_t& map, const uint128_t& key, uint32_t value)
+{
+    map.insert(key, value);
+}
+
+void insert_key(unordered_map_t& map, const uint128_t& key, uint32_t value)
+{
+    map.emplace(key, value);
+}
+
+bool contains_key(const flat_map_t& map, const uint128_t& key)
+{
+    return map.find(key) != nullptr;
+}
+
+bool contains_key(const unordered_map_t& map, const uint128_t& key)
+{
+    return map.find(key) != map.end();
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+template<typename map_t>
+void bench_map_insert(benchmark::State& state)
+{
+    const std::vector<uint128_t> keys = slim::bench::make_random_values<uint128_t>(values_per_iteration);
+
+    for (auto _ : state) {
+
+        // map grows from empty, destruction is not timed
+
+        map_t map;
+
+        const auto started_at = std::chrono::steady_clock::now();
+
+        for (size_t n = 0; n < keys.size(); ++n)
+            insert_key(map, keys[n], static_cast<uint32_t>(n));
+
+        const auto finished_at = std::chrono::steady_clock::now();
+        const double elapsed_seconds = std::chrono::duration<double>(finished_at - started_at).count();
+
+        benchmark::DoNotOptimize(map.size());
+        state.SetIterationTime(elapsed_seconds);
+    }
+
+    state.SetItemsProcessed(state.iterations() * values_per_iteration);
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+template<typename map_t, bool present>
+void bench_map_find(benchmark::State& state)
+{
+    const std::vector<uint128_t> keys = slim::bench::make_random_values<uint128_t>(values_per_iteration);
+    const std::vector<uint128_t> absent_keys = slim::bench::make_random_values<uint128_t>(present ? 0 : values_per_iteration, 0xbeef);
+
+    map_t map;
+
+    for (size_t n = 0; n < keys.size(); ++n)
+        insert_key(map, keys[n], static_cast<uint32_t>(n));
+
+    const std::vector<uint128_t>& lookups = present ? keys : absent_keys;
+
+    for (auto _ : state) {
+
+        size_t found = 0;
+
+        const auto started_at = std::chrono::steady_clock::now();
+
+        for (const uint128_t& key : lookups)
+            found += contains_key(map, key);
+
+        const auto finished_at = std::chrono::steady_clock::now();
+        const double elapsed_seconds = std::chrono::duration<double>(finished_at - started_at).count();
+
+        benchmark::DoNotOptimize(found);
+        state.SetIterationTime(elapsed_seconds);
+    }
+
+    state.SetItemsProcessed(state.iterations() * values_per_iteration);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// Benchmarks entry points
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+BENCHMARK_TEMPLATE(bench_map_insert, flat_map_t)->UseManualTime()->Iterations(3);
+BENCHMARK_TEMPLATE(bench_map_insert, unordered_map_t)->UseManualTime()->Iterations(3);
+BENCHMARK_TEMPLATE(bench_map_find, flat_map_t, true)->UseManualTime()->Iterations(3);
+BENCHMARK_TEMPLATE(bench_map_find, unordered_map_t, true)->UseManualTime()->Iterations(3);
+BENCHMARK_TEMPLATE(bench_map_find, flat_map_t, false)->UseManualTime()->Iterations(3);
+BENCHMARK_TEMPLATE(bench_map_find, unordered_map_t, false)->UseManualTime()->Iterations(3);
+
+} // namespace
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// End of file flat_map_bench.cpp
+////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,205 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// Simple Long Integer Math for C++
+// version 2.0
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// Licensed under the MIT License <http://opensource.org/licenses/MIT>.
+// SPDX-License-Identifier: MIT
+//
+// Copyright (c) 2026 Yury Kalmykov <y_kalmykov@mail.ru>.
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+#include "bench_helpers.h"
+
+#include <benchmark/benchmark.h>
+#include <chrono>
+#include <functional>
+#include <span>
+#include <unordered_set>
+#include <vector>
+
+namespace
+{
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// constants
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+constexpr size_t values_per_iteration = 1 << 15;
+constexpr size_t bucket_bits = 16;
+
+enum class keys_t
+{
+    interfaces,
+    subnets,
+};
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// hashers
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+// per-digit boost-style combination, as std::hash was implemented before
+
+struct combine_hasher
+{
+    size_t operator()(const uint128_t& value) const noexcept
+    {
+        size_t result = static_cast<size_t>(value.digits[0]);
+
+        for (slim::uint_t n = 1; n < std::size(value.digits); ++n)
+            result ^= static_cast<size_t>(value.digits[n]) + size_t(0x9e3779b9) + (result << 6) + (result >> 2);
+
+        return result;
+    }
+};
+
+struct multiply_fold_hasher
+{
+    size_t operator()(const uint128_t& value) const noexcept
+    {
+        return slim::hash(value);
+    }
+};
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// standalone functions
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+std::vector<uint128_t> make_ipv6_keys(keys_t kind, size_t count)
+{
+    const uint128_t prefix = uint128_t(0x20010db800000000ull) << 64;
+
+    std::vector<uint128_t> keys(count);
+
+    for (size_t n = 0; n < count; ++n) {
+
+        // sequential interface identifiers in few /64 subnets, or the first address of every /64
+        // subnet of a /32 prefix, which differ only in bits of the high digit
+
+        if (kind == keys_t::interfaces)
+            keys[n] = prefix + (uint128_t(n % 16) << 64) + uint128_t(n / 16 + 1);
+        else
+            keys[n] = prefix + (uint128_t(n) << 80) + uint128_t(1);
+    }
+
+    return keys;
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+template<typename hasher_t, keys_t kind>
+void bench_hash(benchmark::State& state)
+{
+    const std::vector<uint128_t> keys = make_ipv6_keys(kind, values_per_iteration);
+    std::vector<size_t> hashes(keys.size());
+
+    for (auto _ : state) {
+
+        const auto started_at = std::chrono::steady_clock::now();
+
+        for (size_t n = 0; n < keys.size(); ++n)
+            hashes[n] = hasher_t()(keys[n]);
+
+        const auto finished_at = std::chrono::steady_clock::now();
+        const double elapsed_seconds = std::chrono::duration<double>(finished_at - started_at).count();
+
+        benchmark::DoNotOptimize(hashes.data());
+        state.SetIterationTime(elapsed_seconds);
+    }
+
+    // keys falling into occupied buckets of a table indexed by low bits, as open addressing does
+
+    std::vector<bool> occupied(size_t(1) << bucket_bits);
+    size_t collisions = 0;
+
+    for (size_t hash : hashes) {
+
+        const size_t bucket = hash & (occupied.size() - 1);
+
+        collisions += occupied[bucket];
+        occupied[bucket] = true;
+    }
+
+    state.counters["collisions"] = static_cast<double>(collisions);
+    state.SetItemsProcessed(state.iterations() * values_per_iteration);
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void bench_hash_n(benchmark::State& state)
+{
+    const std::vector<uint128_t> keys = make_ipv6_keys(keys_t::interfaces, values_per_iteration);
+    std::vector<size_t> hashes(keys.size());
+
+    for (auto _ : state) {
+
+        const auto started_at = std::chrono::steady_clock::now();
+        slim::hash_n(std::span<const uint128_t>(keys), std::span<size_t>(hashes));
+        const auto finished_at = std::chrono::steady_clock::now();
+        const double elapsed_seconds = std::chrono::duration<double>(finished_at - started_at).count();
+
+        benchmark::DoNotOptimize(hashes.data());
+        state.SetIterationTime(elapsed_seconds);
+    }
+
+    state.SetItemsProcessed(state.iterations() * values_per_iteration);
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+template<typename hasher_t, keys_t kind>
+void bench_unordered_set(benchmark::State& state)
+{
+    const std::vector<uint128_t> keys = make_ipv6_keys(kind, values_per_iteration);
+
+    for (auto _ : state) {
+
+        const auto started_at = std::chrono::steady_clock::now();
+
+        std::unordered_set<uint128_t, hasher_t> values(keys.begin(), keys.end());
+        size_t found = 0;
+
+        for (const uint128_t& key : keys)
+            found += values.count(key);
+
+        const auto finished_at = std::chrono::steady_clock::now();
+        const double elapsed_seconds = std::chrono::duration<double>(finished_at - started_at).count();
+
+        benchmark::DoNotOptimize(found);
+        state.SetIterationTime(elapsed_seconds);
+    }
+
+    state.SetItemsProcessed(state.iterations() * values_per_iteration);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// Benchmarks entry points
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#define BENCHMARK_FOR_KEY_SETS(function_name, iterations, ...) \
+    BENCHMARK_TEMPLATE(function_name, __VA_ARGS__, keys_t::interfaces)->UseManualTime()->Iterations(iterations); \
+    BENCHMARK_TEMPLATE(function_name, __VA_ARGS__, keys_t::subnets)->UseManualTime()->Iterations(iterations)
+
+BENCHMARK_FOR_KEY_SETS(bench_hash, 200, combine_hasher);
+BENCHMARK_FOR_KEY_SETS(bench_hash, 200, multiply_fold_hasher);
+BENCHMARK(bench_hash_n)->UseManualTime()->Iterations(200);
+BENCHMARK_FOR_KEY_SETS(bench_unordered_set, 20, combine_hasher);
+BENCHMARK_FOR_KEY_SETS(bench_unordered_set, 20, multiply_fold_hasher);
+
+#undef BENCHMARK_FOR_KEY_SETS
+
+} // namespace
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// End of file hash_bench.cpp
+////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,357 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// Simple Long Integer Math for C++
+// version 2.0
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// Licensed under the MIT License <http://opensource.org/licenses/MIT>.
+// SPDX-License-Identifier: MIT
+//
+// Copyright (c) 2026 Yury Kalmykov <y_kalmykov@mail.ru>.
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "bench_helpers.h"
+
+#include <slimcpplib/long_io.h>
+
+#include <array>
+#include <benchmark/benchmark.h>
+#include <chrono>
+#include <iomanip>
+#include <sstream>
+#include <string>
+
+namespace
+{
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// constants
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+constexpr size_t values_per_iteration = 1024;
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// formatters
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+struct format_to_chars
+{
+    template<typename type_t>
+    char* operator()(char* first, char* last, const type_t& value, int base) const noexcept
+    {
+        return slim::to_chars(first, last, value, base).ptr;
+    }
+};
+
+struct format_generic
+{
+    // reference formatter, that divides by base^k chunks for every base
+
+    template<typename type_t>
+    char* operator()(char* first, char*, const type_t& value, int base) const noexcept
+    {
+        using native_t = native_word_t<type_t>;
+
+        const slim::impl::chunk_traits_t<native_t> traits = slim::impl::get_chunk_traits<native_t>(static_cast<slim::uint_t>(base));
+        const slim::uint_t digit_size = slim::impl::count_digits(value, static_cast<slim::uint_t>(base));
+
+        char* const digits_last = first + digit_size;
+        char* digits_out = digits_last;
+
+        type_t remainder = value;
+        type_t chunk;
+
+        while (digits_out != first) {
+
+            remainder = divqr(remainder, type_t(traits.chunk_base), chunk);
+            native_t chunk_value = static_cast<native_t>(chunk);
+
+            for (slim::uint_t n = 0; n < traits.digits_per_chunk && digits_out != first; ++n) {
+
+                *--digits_out = slim::impl::digit_chars[static_cast<slim::uint_t>(chunk_value % static_cast<native_t>(base))];
+                chunk_value /= static_cast<native_t>(base);
+            }
+        }
+
+        return digits_last;
+    }
+};
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// parsers
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+struct parse_from_chars
+{
+    template<typename type_t>
+    const char* operator()(const char* first, const char* last, type_t& value, int base) const noexcept
+    {
+        return slim::from_chars(first, last, value, base).ptr;
+    }
+};
+
+struct parse_generic
+{
+    // reference parser, that validates and accumulates one character at a time
+
+    template<typename type_t>
+    const char* operator()(const char* first, const char* last, type_t& value, int base) const noexcept
+    {
+        using native_t = native_word_t<type_t>;
+
+        const slim::impl::chunk_traits_t<native_t> traits = slim::impl::get_chunk_traits<native_t>(static_cast<slim::uint_t>(base));
+
+        type_t result = 0;
+
+        while (first != last && slim::impl::char_to_digit(*first) < static_cast<slim::uint_t>(base)) {
+
+            native_t chunk = 0;
+            native_t multiplier = 1;
+
+            for (slim::uint_t n = 0; n < traits.digits_per_chunk && first != last; ++n, ++first) {
+
+                const slim::uint_t digit = slim::impl::char_to_digit(*first);
+
+                if (digit >= static_cast<slim::uint_t>(base))
+                    break;
+
+                chunk = chunk * static_cast<native_t>(base) + static_cast<native_t>(digit);
+                multiplier *= static_cast<native_t>(base);
+            }
+
+            slim::impl::mul_add_chunk(result, multiplier, chunk);
+        }
+
+        value = result;
+
+        return first;
+    }
+};
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// standalone functions
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+template<typename type_t, typename formatter_t, int base>
+void bench_format(benchmark::State& state)
+{
+    const std::vector<type_t> values = slim::bench::make_random_values<type_t>(values_per_iteration);
+    std::array<char, slim::bit_count_v<type_t>> buffer;
+
+    for (auto _ : state) {
+
+        size_t total_size = 0;
+
+        const auto started_at = std::chrono::steady_clock::now();
+
+        for (const type_t& value : values) {
+
+            const char* const last = formatter_t()(buffer.data(), buffer.data() + buffer.size(), value, base);
+            total_size += static_cast<size_t>(last - buffer.data());
+            benchmark::DoNotOptimize(buffer.data());
+        }
+
+        const auto finished_at = std::chrono::steady_clock::now();
+        const double elapsed_seconds = std::chrono::duration<double>(finished_at - started_at).count();
+
+        benchmark::DoNotOptimize(total_size);
+        state.SetIterationTime(elapsed_seconds);
+    }
+
+    state.SetItemsProcessed(state.iterations() * values_per_iteration);
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+template<typename type_t, typename parser_t, int base>
+void bench_parse(benchmark::State& state)
+{
+    const std::vector<type_t> values = slim::bench::make_random_values<type_t>(values_per_iteration);
+    std::vector<std::string> texts;
+    std::array<char, slim::bit_count_v<type_t>> buffer;
+
+    for (const type_t& value : values)
+        texts.emplace_back(buffer.data(), slim::to_chars(buffer.data(), buffer.data() + buffer.size(), value, base).ptr);
+
+    for (auto _ : state) {
+
+        type_t total = 0;
+
+        const auto started_at = std::chrono::steady_clock::now();
+
+        for (const std::string& text : texts) {
+
+            type_t value = 0;
+            parser_t()(text.data(), text.data() + text.size(), value, base);
+            total += value;
+        }
+
+        const auto finished_at = std::chrono::steady_clock::now();
+        const double elapsed_seconds = std::chrono::duration<double>(finished_at - started_at).count();
+
+        benchmark::DoNotOptimize(total);
+        state.SetIterationTime(elapsed_seconds);
+    }
+
+    state.SetItemsProcessed(state.iterations() * values_per_iteration);
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+template<typename type_t, int base>
+void bench_stream_output(benchmark::State& state)
+{
+    const std::vector<type_t> values = slim::bench::make_random_values<type_t>(values_per_iteration);
+    std::ostringstream stream;
+
+    if constexpr (base == 16)
+        stream << std::hex;
+    else if constexpr (base == 8)
+        stream << std::oct;
+    else if constexpr (base == 2)
+        stream << slim::bin;
+
+    for (auto _ : state) {
+
+        stream.str("");
+
+        const auto started_at = std::chrono::steady_clock::now();
+
+        for (const type_t& value : values)
+            stream << value << ' ';
+
+        const auto finished_at = std::chrono::steady_clock::now();
+        const double elapsed_seconds = std::chrono::duration<double>(finished_at - started_at).count();
+
+        benchmark::DoNotOptimize(stream.tellp());
+        state.SetIterationTime(elapsed_seconds);
+    }
+
+    state.SetItemsProcessed(state.iterations() * values_per_iteration);
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+template<typename type_t, int base>
+void bench_stream_output_padded(benchmark::State& state)
+{
+    const std::vector<type_t> values = slim::bench::make_random_values<type_t>(values_per_iteration);
+    const std::streamsize width = static_cast<std::streamsize>(slim::bit_count_v<type_t> / 2);
+    std::ostringstream stream;
+
+    if constexpr (base == 16)
+        stream << std::hex;
+
+    stream << std::setfill('.');
+
+    for (auto _ : state) {
+
+        stream.str("");
+
+        const auto started_at = std::chrono::steady_clock::now();
+
+        for (const type_t& value : values)
+            stream << std::setw(width) << (value >> (slim::bit_count_v<type_t> / 2));
+
+        const auto finished_at = std::chrono::steady_clock::now();
+        const double elapsed_seconds = std::chrono::duration<double>(finished_at - started_at).count();
+
+        benchmark::DoNotOptimize(stream.tellp());
+        state.SetIterationTime(elapsed_seconds);
+    }
+
+    state.SetItemsProcessed(state.iterations() * values_per_iteration);
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+template<typename type_t, int base>
+void bench_stream_input(benchmark::State& state)
+{
+    const std::vector<type_t> values = slim::bench::make_random_values<type_t>(values_per_iteration);
+    std::ostringstream output;
+
+    if constexpr (base == 16)
+        output << std::hex;
+
+    for (const type_t& value : values)
+        output << value << ' ';
+
+    const std::string text = output.str();
+    std::istringstream stream;
+
+    if constexpr (base == 16)
+        stream >> std::hex;
+
+    for (auto _ : state) {
+
+        stream.str(text);
+        stream.clear();
+
+        type_t total = 0;
+        type_t value = 0;
+
+        const auto started_at = std::chrono::steady_clock::now();
+
+        while (stream >> value)
+            total += value;
+
+        const auto finished_at = std::chrono::steady_clock::now();
+        const double elapsed_seconds = std::chrono::duration<double>(finished_at - started_at).count();
+
+        benchmark::DoNotOptimize(total);
+        state.SetIterationTime(elapsed_seconds);
+    }
+
+    state.SetItemsProcessed(state.iterations() * values_per_iteration);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// Benchmarks entry points
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#define BENCHMARK_FOR_IO_TYPES(function_name, ...) \
+    BENCHMARK_TEMPLATE(function_name, uint128_t __VA_OPT__(,) __VA_ARGS__)->UseManualTime()->Iterations(200); \
+    BENCHMARK_TEMPLATE(function_name, uint256_t __VA_OPT__(,) __VA_ARGS__)->UseManualTime()->Iterations(200)
+
+BENCHMARK_FOR_IO_TYPES(bench_format, format_generic, 16);
+BENCHMARK_FOR_IO_TYPES(bench_format, format_to_chars, 16);
+BENCHMARK_FOR_IO_TYPES(bench_format, format_generic, 8);
+BENCHMARK_FOR_IO_TYPES(bench_format, format_to_chars, 8);
+BENCHMARK_FOR_IO_TYPES(bench_format, format_generic, 2);
+BENCHMARK_FOR_IO_TYPES(bench_format, format_to_chars, 2);
+BENCHMARK_FOR_IO_TYPES(bench_format, format_generic, 10);
+BENCHMARK_FOR_IO_TYPES(bench_format, format_to_chars, 10);
+
+BENCHMARK_FOR_IO_TYPES(bench_parse, parse_generic, 10);
+BENCHMARK_FOR_IO_TYPES(bench_parse, parse_from_chars, 10);
+BENCHMARK_FOR_IO_TYPES(bench_parse, parse_generic, 16);
+BENCHMARK_FOR_IO_TYPES(bench_parse, parse_from_chars, 16);
+
+BENCHMARK_FOR_IO_TYPES(bench_stream_output, 16);
+BENCHMARK_FOR_IO_TYPES(bench_stream_output, 8);
+BENCHMARK_FOR_IO_TYPES(bench_stream_output, 2);
+BENCHMARK_FOR_IO_TYPES(bench_stream_output, 10);
+BENCHMARK_FOR_IO_TYPES(bench_stream_output_padded, 16);
+BENCHMARK_FOR_IO_TYPES(bench_stream_output_padded, 10);
+
+BENCHMARK_FOR_IO_TYPES(bench_stream_input, 16);
+BENCHMARK_FOR_IO_TYPES(bench_stream_input, 10);
+
+#undef BENCHMARK_FOR_IO_TYPES
+} // namespace
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// End of file io_bench.cpp
+////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,170 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// Simple Long Integer Math for C++
+// version 2.0
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// Licensed under the MIT License <http://opensource.org/licenses/MIT>.
+// SPDX-License-Identifier: MIT
+//
+// Copyright (c) 2026 Yury Kalmykov <y_kalmykov@mail.ru>.
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+#include "bench_helpers.h"
+
+#include <slimcpplib/long_parallel.h>
+
+#include <benchmark/benchmark.h>
+#include <chrono>
+#include <random>
+#include <span>
+#include <vector>
+
+namespace
+{
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// constants
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+constexpr size_t values_per_iteration = 1 << 20;
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// standalone functions
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+template<typename type_t>
+void bench_parallel_radix_sort(benchmark::State& state)
+{
+    slim::thread_pool pool(static_cast<slim::uint_t>(state.range(0)));
+
+    const std::vector<type_t> source = slim::bench::make_random_values<type_t>(values_per_iteration);
+    std::vector<type_t> values(source.size());
+    std::vector<type_t> buffer(source.size());
+
+    for (auto _ : state) {
+
+        std::copy(source.begin(), source.end(), values.begin());
+
+        const auto started_at = std::chrono::steady_clock::now();
+        slim::parallel_radix_sort(pool, std::span<type_t>(values), std::span<type_t>(buffer));
+        const auto finished_at = std::chrono::steady_clock::now();
+        const double elapsed_seconds = std::chrono::duration<double>(finished_at - started_at).count();
+
+        benchmark::DoNotOptimize(values.data());
+        state.SetIterationTime(elapsed_seconds);
+    }
+
+    state.SetItemsProcessed(state.iterations() * values_per_iteration);
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+template<typename type_t>
+void bench_parallel_reduce(benchmark::State& state)
+{
+    slim::thread_pool pool(static_cast<slim::uint_t>(state.range(0)));
+
+    const std::vector<type_t> values = slim::bench::make_random_values<type_t>(values_per_iteration);
+
+    for (auto _ : state) {
+
+        const auto started_at = std::chrono::steady_clock::now();
+        const type_t sum = slim::parallel_reduce(pool, std::span<const type_t>(values));
+        const auto finished_at = std::chrono::steady_clock::now();
+        const double elapsed_seconds = std::chrono::duration<double>(finished_at - started_at).count();
+
+        benchmark::DoNotOptimize(sum);
+        state.SetIterationTime(elapsed_seconds);
+    }
+
+    state.SetItemsProcessed(state.iterations() * values_per_iteration);
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void bench_parallel_dot_exact(benchmark::State& state)
+{
+    slim::thread_pool pool(static_cast<slim::uint_t>(state.range(0)));
+
+    std::mt19937_64 engine(0x5eed);
+    std::vector<int64_t> values1(values_per_iteration);
+    std::vector<int64_t> values2(values_per_iteration);
+
+    for (size_t n = 0; n < values_per_iteration; ++n) {
+
+        values1[n] = static_cast<int64_t>(engine());
+        values2[n] = static_cast<int64_t>(engine());
+    }
+
+    for (auto _ : state) {
+
+        const auto started_at = std::chrono::steady_clock::now();
+        const int256_t sum = slim::parallel_dot_exact(pool, std::span<const int64_t>(values1), std::span<const int64_t>(values2));
+        const auto finished_at = std::chrono::steady_clock::now();
+        const double elapsed_seconds = std::chrono::duration<double>(finished_at - started_at).count();
+
+        benchmark::DoNotOptimize(sum);
+        state.SetIterationTime(elapsed_seconds);
+    }
+
+    state.SetItemsProcessed(state.iterations() * values_per_iteration);
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+template<typename type_t>
+void bench_serial_reduce(benchmark::State& state)
+{
+    const std::vector<type_t> values = slim::bench::make_random_values<type_t>(values_per_iteration);
+
+    for (auto _ : state) {
+
+        const auto started_at = std::chrono::steady_clock::now();
+
+        // carries ripple through all digits of every addition
+
+        type_t sum = 0;
+
+        for (const type_t& value : values)
+            sum += value;
+
+        const auto finished_at = std::chrono::steady_clock::now();
+        const double elapsed_seconds = std::chrono::duration<double>(finished_at - started_at).count();
+
+        benchmark::DoNotOptimize(sum);
+        state.SetIterationTime(elapsed_seconds);
+    }
+
+    state.SetItemsProcessed(state.iterations() * values_per_iteration);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// Benchmarks entry points
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+// thread counts form the scaling curve, counts above the number of cores show oversubscription
+
+#define BENCHMARK_FOR_PARALLEL_TYPES(function_name) \
+    BENCHMARK_TEMPLATE(function_name, uint128_t)->RangeMultiplier(2)->Range(1, 32)->UseManualTime()->Iterations(20); \
+    BENCHMARK_TEMPLATE(function_name, int256_t)->RangeMultiplier(2)->Range(1, 32)->UseManualTime()->Iterations(20)
+
+BENCHMARK_FOR_PARALLEL_TYPES(bench_parallel_radix_sort);
+BENCHMARK_FOR_PARALLEL_TYPES(bench_parallel_reduce);
+BENCHMARK(bench_parallel_dot_exact)->RangeMultiplier(2)->Range(1, 32)->UseManualTime()->Iterations(20);
+BENCHMARK_TEMPLATE(bench_serial_reduce, uint128_t)->UseManualTime()->Iterations(20);
+BENCHMARK_TEMPLATE(bench_serial_reduce, int256_t)->UseManualTime()->Iterations(20);
+
+#undef BENCHMARK_FOR_PARALLEL_TYPES
+} // namespace
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// End of file parallel_bench.cpp
+////////////////////////////////////////////////////////////////////////////////////////////////////
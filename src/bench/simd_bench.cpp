@@ -0,0 +1,181 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// Simple Long Integer Math for C++
+// version 2.0
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// Licensed under the MIT License <http://opensource.org/licenses/MIT>.
+// SPDX-License-Identifier: MIT
+//
+// Copyright (c) 2026 Yury Kalmykov <y_kalmykov@mail.ru>.
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+#include "bench_helpers.h"
+
+#include <slimcpplib/long_simd.h>
+
+#include <benchmark/benchmark.h>
+#include <chrono>
+#include <span>
+#include <vector>
+
+namespace
+{
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// constants
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+constexpr size_t values_per_iteration = 1024;
+
+enum class operation_t
+{
+    add,
+    sub,
+    mul,
+};
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// kernels
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+struct kernel_scalar
+{
+    // reference kernel, that runs the addc chain of every element
+
+    template<typename type_t>
+    void add(std::span<type_t> result, std::span<const type_t> values1, std::span<const type_t> values2) const noexcept
+    {
+        for (size_t n = 0; n < result.size(); ++n)
+            result[n] = values1[n] + values2[n];
+    }
+
+    template<typename type_t>
+    void sub(std::span<type_t> result, std::span<const type_t> values1, std::span<const type_t> values2) const noexcept
+    {
+        for (size_t n = 0; n < result.size(); ++n)
+            result[n] = values1[n] - values2[n];
+    }
+
+    template<typename type_t>
+    void mul(std::span<type_t> result, std::span<const type_t> values1, std::span<const type_t> values2) const noexcept
+    {
+        for (size_t n = 0; n < result.size(); ++n)
+            result[n] = values1[n] * values2[n];
+    }
+};
+
+struct kernel_dispatched
+{
+    template<typename type_t>
+    void add(std::span<type_t> result, std::span<const type_t> values1, std::span<const type_t> values2) const noexcept
+    {
+        slim::add_n(result, values1, values2);
+    }
+
+    template<typename type_t>
+    void sub(std::span<type_t> result, std::span<const type_t> values1, std::span<const type_t> values2) const noexcept
+    {
+        slim::sub_n(result, values1, values2);
+    }
+
+    template<typename type_t>
+    void mul(std::span<type_t> result, std::span<const type_t> values1, std::span<const type_t> values2) const noexcept
+    {
+        slim::mul_n(result, values1, values2);
+    }
+};
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// standalone functions
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+template<typename type_t, typename kernel_t, operation_t operation>
+void bench_kernel(benchmark::State& state)
+{
+    const std::vector<type_t> values1 = slim::bench::make_random_values<type_t>(values_per_iteration, 1);
+    const std::vector<type_t> values2 = slim::bench::make_random_values<type_t>(values_per_iteration, 2);
+    std::vector<type_t> results(values_per_iteration);
+
+    for (auto _ : state) {
+
+        const auto started_at = std::chrono::steady_clock::now();
+
+        const std::span<type_t> result_span(results);
+        const std::span<const type_t> values1_span(values1);
+        const std::span<const type_t> values2_span(values2);
+
+        if constexpr (operation == operation_t::add)
+            kernel_t().add(result_span, values1_span, values2_span);
+        else if constexpr (operation == operation_t::sub)
+            kernel_t().sub(result_span, values1_span, values2_span);
+        else
+            kernel_t().mul(result_span, values1_span, values2_span);
+
+        const auto finished_at = std::chrono::steady_clock::now();
+        const double elapsed_seconds = std::chrono::duration<double>(finished_at - started_at).count();
+
+        benchmark::DoNotOptimize(results.data());
+        state.SetIterationTime(elapsed_seconds);
+    }
+
+    state.SetItemsProcessed(state.iterations() * values_per_iteration);
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+template<typename type_t, typename kernel_t>
+void bench_add_n(benchmark::State& state)
+{
+    bench_kernel<type_t, kernel_t, operation_t::add>(state);
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+template<typename type_t, typename kernel_t>
+void bench_sub_n(benchmark::State& state)
+{
+    bench_kernel<type_t, kernel_t, operation_t::sub>(state);
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+template<typename type_t, typename kernel_t>
+void bench_mul_n(benchmark::State& state)
+{
+    bench_kernel<type_t, kernel_t, operation_t::mul>(state);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// Benchmarks entry points
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#define BENCHMARK_FOR_SIMD_TYPES(function_name, ...) \
+    BENCHMARK_TEMPLATE(function_name, uint128_t __VA_OPT__(,) __VA_ARGS__)->UseManualTime()->Iterations(200); \
+    BENCHMARK_TEMPLATE(function_name, int128_t __VA_OPT__(,) __VA_ARGS__)->UseManualTime()->Iterations(200); \
+    BENCHMARK_TEMPLATE(function_name, uint256_t __VA_OPT__(,) __VA_ARGS__)->UseManualTime()->Iterations(200)
+
+BENCHMARK_FOR_SIMD_TYPES(bench_add_n, kernel_scalar);
+BENCHMARK_FOR_SIMD_TYPES(bench_add_n, kernel_dispatched);
+
+BENCHMARK_FOR_SIMD_TYPES(bench_sub_n, kernel_scalar);
+BENCHMARK_FOR_SIMD_TYPES(bench_sub_n, kernel_dispatched);
+
+BENCHMARK_FOR_SIMD_TYPES(bench_mul_n, kernel_scalar);
+BENCHMARK_FOR_SIMD_TYPES(bench_mul_n, kernel_dispatched);
+
+#undef BENCHMARK_FOR_SIMD_TYPES
+} // namespace
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// End of file simd_bench.cpp
+////////////////////////////////////////////////////////////////////////////////////////////////////
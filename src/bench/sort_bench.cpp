@@ -0,0 +1,226 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// Simple Long Integer Math for C++
+// version 2.0
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// Licensed under the MIT License <http://opensource.org/licenses/MIT>.
+// SPDX-License-Identifier: MIT
+//
+// Copyright (c) 2026 Yury Kalmykov <y_kalmykov@mail.ru>.
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "bench_helpers.h"
+
+#include <slimcpplib/long_sort.h>
+
+#include <algorithm>
+#include <benchmark/benchmark.h>
+#include <chrono>
+#include <compare>
+
+namespace
+{
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// constants
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+constexpr size_t values_per_iteration = 4096;
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// comparators
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+struct less_compare
+{
+    template<typename type_t>
+    bool operator()(const type_t& lhs, const type_t& rhs) const noexcept
+    {
+        return lhs < rhs;
+    }
+};
+
+struct three_way_compare
+{
+    template<typename type_t>
+    bool operator()(const type_t& lhs, const type_t& rhs) const noexcept
+    {
+        return std::is_lt(lhs <=> rhs);
+    }
+};
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// standalone functions
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+template<typename type_t, typename compare_t>
+void bench_sort(benchmark::State& state)
+{
+    const std::vector<type_t> source = slim::bench::make_random_values<type_t>(values_per_iteration);
+    std::vector<type_t> values(source.size());
+
+    for (auto _ : state) {
+
+        std::copy(source.begin(), source.end(), values.begin());
+
+        const auto started_at = std::chrono::steady_clock::now();
+        std::sort(values.begin(), values.end(), compare_t());
+        const auto finished_at = std::chrono::steady_clock::now();
+        const double elapsed_seconds = std::chrono::duration<double>(finished_at - started_at).count();
+
+        benchmark::DoNotOptimize(values.data());
+        state.SetIterationTime(elapsed_seconds);
+    }
+
+    state.SetItemsProcessed(state.iterations() * values_per_iteration);
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+template<typename type_t, size_t value_bits>
+void bench_radix_sort(benchmark::State& state)
+{
+    std::vector<type_t> source = slim::bench::make_random_values<type_t>(values_per_iteration);
+    std::vector<type_t> values(source.size());
+    std::vector<type_t> buffer(source.size());
+
+    // narrow values leave high bytes equal, so that their passes are skipped
+
+    for (type_t& value : source)
+        value >>= slim::bit_count_v<type_t> - value_bits;
+
+    for (auto _ : state) {
+
+        std::copy(source.begin(), source.end(), values.begin());
+
+        const auto started_at = std::chrono::steady_clock::now();
+        slim::radix_sort(std::span<type_t>(values), std::span<type_t>(buffer));
+        const auto finished_at = std::chrono::steady_clock::now();
+        const double elapsed_seconds = std::chrono::duration<double>(finished_at - started_at).count();
+
+        benchmark::DoNotOptimize(values.data());
+        state.SetIterationTime(elapsed_seconds);
+    }
+
+    state.SetItemsProcessed(state.iterations() * values_per_iteration);
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+template<typename type_t>
+void bench_binary_search_three_way(benchmark::State& state)
+{
+    std::vector<type_t> values = slim::bench::make_random_values<type_t>(values_per_iteration);
+    const std::vector<type_t> keys = slim::bench::make_random_values<type_t>(values_per_iteration, 0xbeef);
+
+    std::sort(values.begin(), values.end());
+
+    for (auto _ : state) {
+
+        size_t found = 0;
+
+        const auto started_at = std::chrono::steady_clock::now();
+
+        // one three-way comparison per step decides between less, equal and greater
+
+        for (const type_t& key : keys) {
+
+            size_t first = 0;
+            size_t last = values.size();
+
+            while (first < last) {
+
+                const size_t middle = first + (last - first) / 2;
+                const std::strong_ordering order = values[middle] <=> key;
+
+                if (order == 0) {
+
+                    ++found;
+                    break;
+                }
+
+                if (order < 0)
+                    first = middle + 1;
+                else
+                    last = middle;
+            }
+        }
+
+        const auto finished_at = std::chrono::steady_clock::now();
+        const double elapsed_seconds = std::chrono::duration<double>(finished_at - started_at).count();
+
+        benchmark::DoNotOptimize(found);
+        state.SetIterationTime(elapsed_seconds);
+    }
+
+    state.SetItemsProcessed(state.iterations() * values_per_iteration);
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+template<typename type_t>
+void bench_binary_search_less(benchmark::State& state)
+{
+    std::vector<type_t> values = slim::bench::make_random_values<type_t>(values_per_iteration);
+    const std::vector<type_t> keys = slim::bench::make_random_values<type_t>(values_per_iteration, 0xbeef);
+
+    std::sort(values.begin(), values.end());
+
+    for (auto _ : state) {
+
+        size_t found = 0;
+
+        const auto started_at = std::chrono::steady_clock::now();
+
+        // lower bound followed by an equality check, as with two-way comparisons only
+
+        for (const type_t& key : keys) {
+
+            const auto it = std::lower_bound(values.begin(), values.end(), key);
+
+            if (it != values.end() && !(key < *it))
+                ++found;
+        }
+
+        const auto finished_at = std::chrono::steady_clock::now();
+        const double elapsed_seconds = std::chrono::duration<double>(finished_at - started_at).count();
+
+        benchmark::DoNotOptimize(found);
+        state.SetIterationTime(elapsed_seconds);
+    }
+
+    state.SetItemsProcessed(state.iterations() * values_per_iteration);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// Benchmarks entry points
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#define BENCHMARK_FOR_SORT_TYPES(function_name, ...) \
+    BENCHMARK_TEMPLATE(function_name, uint128_t __VA_OPT__(,) __VA_ARGS__)->UseManualTime()->Iterations(200); \
+    BENCHMARK_TEMPLATE(function_name, int256_t __VA_OPT__(,) __VA_ARGS__)->UseManualTime()->Iterations(200)
+
+BENCHMARK_FOR_SORT_TYPES(bench_sort, less_compare);
+BENCHMARK_FOR_SORT_TYPES(bench_sort, three_way_compare);
+BENCHMARK_TEMPLATE(bench_radix_sort, uint128_t, 128)->UseManualTime()->Iterations(200);
+BENCHMARK_TEMPLATE(bench_radix_sort, uint128_t, 48)->UseManualTime()->Iterations(200);
+BENCHMARK_TEMPLATE(bench_radix_sort, int256_t, 256)->UseManualTime()->Iterations(200);
+BENCHMARK_TEMPLATE(bench_radix_sort, int256_t, 48)->UseManualTime()->Iterations(200);
+BENCHMARK_FOR_SORT_TYPES(bench_binary_search_less);
+BENCHMARK_FOR_SORT_TYPES(bench_binary_search_three_way);
+
+#undef BENCHMARK_FOR_SORT_TYPES
+} // namespace
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// End of file sort_bench.cpp
+////////////////////////////////////////////////////////////////////////////////////////////////////
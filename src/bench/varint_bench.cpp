@@ -0,0 +1,189 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// Simple Long Integer Math for C++
+// version 2.0
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// Licensed under the MIT License <http://opensource.org/licenses/MIT>.
+// SPDX-License-Identifier: MIT
+//
+// Copyright (c) 2026 Yury Kalmykov <y_kalmykov@mail.ru>.
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+#include "bench_helpers.h"
+
+#include <slimcpplib/long_varint.h>
+
+#include <algorithm>
+#include <benchmark/benchmark.h>
+#include <chrono>
+#include <random>
+#include <span>
+#include <vector>
+
+namespace
+{
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// constants
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+constexpr size_t values_per_iteration = 1024;
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// codecs
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+struct codec_fixed
+{
+    // reference codec, that stores every value in full width
+
+    template<typename type_t>
+    size_t encode(std::span<const type_t> values, std::span<std::byte> bytes) const noexcept
+    {
+        slim::to_bytes_le(values, bytes.first(values.size_bytes()));
+        return values.size_bytes();
+    }
+
+    template<typename type_t>
+    size_t decode(std::span<const std::byte> bytes, std::span<type_t> values) const noexcept
+    {
+        slim::from_bytes_le(bytes.first(values.size_bytes()), values);
+        return values.size_bytes();
+    }
+};
+
+struct codec_leb128
+{
+    template<typename type_t>
+    size_t encode(std::span<const type_t> values, std::span<std::byte> bytes) const noexcept
+    {
+        return slim::encode_leb128(values, bytes);
+    }
+
+    template<typename type_t>
+    size_t decode(std::span<const std::byte> bytes, std::span<type_t> values) const noexcept
+    {
+        return slim::decode_leb128(bytes, values);
+    }
+};
+
+struct codec_prefix_varint
+{
+    template<typename type_t>
+    size_t encode(std::span<const type_t> values, std::span<std::byte> bytes) const noexcept
+    {
+        return slim::encode_prefix_varint(values, bytes);
+    }
+
+    template<typename type_t>
+    size_t decode(std::span<const std::byte> bytes, std::span<type_t> values) const noexcept
+    {
+        return slim::decode_prefix_varint(bytes, values);
+    }
+};
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// standalone functions
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+template<typename type_t>
+std::vector<type_t> make_skewed_values(size_t count)
+{
+    // uniformly distributed bit lengths, so that most values are much shorter than the type
+
+    std::vector<type_t> values = slim::bench::make_random_values<type_t>(count);
+    std::mt19937_64 engine(0x5eed);
+
+    for (type_t& value : values)
+        value >>= static_cast<slim::uint_t>(engine() % slim::bit_count_v<type_t>);
+
+    return values;
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+template<typename type_t, typename codec_t>
+void bench_encode(benchmark::State& state)
+{
+    const std::vector<type_t> values = make_skewed_values<type_t>(values_per_iteration);
+    std::vector<std::byte> bytes(values.size() * (slim::byte_count_v<type_t> * 2));
+    size_t encoded_size = 0;
+
+    for (auto _ : state) {
+
+        const auto started_at = std::chrono::steady_clock::now();
+
+        encoded_size = codec_t().encode(std::span<const type_t>(values), std::span(bytes));
+
+        const auto finished_at = std::chrono::steady_clock::now();
+        const double elapsed_seconds = std::chrono::duration<double>(finished_at - started_at).count();
+
+        benchmark::DoNotOptimize(bytes.data());
+        state.SetIterationTime(elapsed_seconds);
+    }
+
+    state.SetItemsProcessed(state.iterations() * values_per_iteration);
+    state.counters["bytes_per_value"] = static_cast<double>(encoded_size) / static_cast<double>(values_per_iteration);
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+template<typename type_t, typename codec_t>
+void bench_decode(benchmark::State& state)
+{
+    const std::vector<type_t> values = make_skewed_values<type_t>(values_per_iteration);
+    std::vector<std::byte> bytes(values.size() * (slim::byte_count_v<type_t> * 2));
+    std::vector<type_t> decoded(values.size());
+
+    const size_t encoded_size = codec_t().encode(std::span<const type_t>(values), std::span(bytes));
+
+    for (auto _ : state) {
+
+        const auto started_at = std::chrono::steady_clock::now();
+
+        const size_t decoded_size = codec_t().decode(std::span<const std::byte>(bytes).first(encoded_size), std::span(decoded));
+
+        const auto finished_at = std::chrono::steady_clock::now();
+        const double elapsed_seconds = std::chrono::duration<double>(finished_at - started_at).count();
+
+        benchmark::DoNotOptimize(decoded_size);
+        benchmark::DoNotOptimize(decoded.data());
+        state.SetIterationTime(elapsed_seconds);
+    }
+
+    state.SetItemsProcessed(state.iterations() * values_per_iteration);
+    state.SetBytesProcessed(state.iterations() * static_cast<int64_t>(encoded_size));
+    state.counters["bytes_per_value"] = static_cast<double>(encoded_size) / static_cast<double>(values_per_iteration);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// Benchmarks entry points
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#define BENCHMARK_FOR_VARINT_TYPES(function_name, ...) \
+    BENCHMARK_TEMPLATE(function_name, uint128_t __VA_OPT__(,) __VA_ARGS__)->UseManualTime()->Iterations(200); \
+    BENCHMARK_TEMPLATE(function_name, uint256_t __VA_OPT__(,) __VA_ARGS__)->UseManualTime()->Iterations(200)
+
+BENCHMARK_FOR_VARINT_TYPES(bench_encode, codec_fixed);
+BENCHMARK_FOR_VARINT_TYPES(bench_encode, codec_leb128);
+BENCHMARK_FOR_VARINT_TYPES(bench_encode, codec_prefix_varint);
+
+BENCHMARK_FOR_VARINT_TYPES(bench_decode, codec_fixed);
+BENCHMARK_FOR_VARINT_TYPES(bench_decode, codec_leb128);
+BENCHMARK_FOR_VARINT_TYPES(bench_decode, codec_prefix_varint);
+
+#undef BENCHMARK_FOR_VARINT_TYPES
+} // namespace
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// End of file varint_bench.cpp
+////////////////////////////////////////////////////////////////////////////////////////////////////
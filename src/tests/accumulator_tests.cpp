@@ -0,0 +1,180 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// Simple Long Integer Math for C++
+// version 2.0
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// Licensed under the MIT License <http://opensource.org/licenses/MIT>.
+// SPDX-License-Identifier: MIT
+//
+// Copyright (c) 2020-2026 Yury Kalmykov <y_kalmykov@mail.ru>.
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+#include "type_sets.h"
+
+#include <slimcpplib/long_accumulator.h>
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <array>
+#include <limits>
+#include <vector>
+#include <random>
+
+namespace slim
+{
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// standalone functions
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+template<typename type_t>
+void run_accumulator_tests()
+{
+    using value_t = typename accumulator<type_t>::value_type;
+
+    std::mt19937_64 engine(47);
+
+    // extreme values make carries and borrows frequent, the count crosses folds and blocks
+
+    std::vector<value_t> values(3 * (size_t(1) << std::min<uint_t>(accumulator<type_t>::fold_bits, 14)) + 5);
+
+    for (value_t& value : values) {
+
+        const uint64_t kind = engine() % 4;
+        value = kind == 0 ? std::numeric_limits<value_t>::max() : kind == 1 ? std::numeric_limits<value_t>::min() : static_cast<value_t>(engine());
+    }
+
+    const type_t initial = type_t(static_cast<value_t>(engine())) << (bit_count_v<type_t> / 2);
+    type_t expected = initial;
+
+    for (value_t value : values)
+        expected += type_t(value);
+
+    accumulator<type_t> scalar(initial);
+
+    for (value_t value : values)
+        scalar += value;
+
+    EXPECT_EQ(scalar.value(), expected);
+
+    accumulator<type_t> bulk(initial);
+    bulk.accumulate(std::span<const value_t>(values).first(values.size() / 2));
+    bulk.accumulate(std::span<const value_t>(values).subspan(values.size() / 2));
+    EXPECT_EQ(bulk.value(), expected);
+
+    EXPECT_EQ(accumulate<type_t>(std::span<const value_t>(values)) + initial, expected);
+
+    // partial accumulators are merged exactly
+
+    accumulator<type_t> first(initial);
+    accumulator<type_t> second;
+
+    for (size_t n = 0; n < values.size(); ++n) {
+
+        if (n % 2 == 0)
+            first += values[n];
+        else
+            second += values[n];
+    }
+
+    first += second;
+    EXPECT_EQ(first.value(), expected);
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+template<typename type_t>
+void run_dot_exact_tests()
+{
+    using value_t = typename accumulator<type_t>::value_type;
+
+    std::mt19937_64 engine(48);
+
+    for (size_t count : { 0, 1, 7, 1000 }) {
+
+        std::vector<value_t> values1(count);
+        std::vector<value_t> values2(count);
+
+        for (size_t n = 0; n < count; ++n) {
+
+            // extreme products have the largest magnitude and carry out of both words
+
+            const uint64_t kind = engine() % 4;
+
+            values1[n] = kind == 0 ? std::numeric_limits<value_t>::min() : kind == 1 ? std::numeric_limits<value_t>::max() : static_cast<value_t>(engine());
+            values2[n] = kind == 0 ? std::numeric_limits<value_t>::min() : engine() % 2 == 0 ? std::numeric_limits<value_t>::min() : static_cast<value_t>(engine());
+        }
+
+        type_t expected = 0;
+
+        for (size_t n = 0; n < count; ++n)
+            expected += type_t(values1[n]) * type_t(values2[n]);
+
+        EXPECT_EQ(dot_exact<type_t>(std::span<const value_t>(values1), std::span<const value_t>(values2)), expected);
+    }
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// accumulator_tests
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+TEST(accumulator_tests, family_128_and_256_native_values)
+{
+    run_accumulator_tests<uint128_t>();
+    run_accumulator_tests<int128_t>();
+    run_accumulator_tests<uint256_t>();
+    run_accumulator_tests<int256_t>();
+    run_accumulator_tests<int32x4_t>();
+    run_accumulator_tests<long_int_t<uint16_t, 4>>();
+    run_accumulator_tests<long_uint_t<uint16_t, 4>>();
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+TEST(accumulator_tests, family_128_and_256_dot_exact)
+{
+    run_dot_exact_tests<int256_t>();
+    run_dot_exact_tests<uint256_t>();
+    run_dot_exact_tests<int32x4_t>();
+    run_dot_exact_tests<long_int_t<uint64_t, 8>>();
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+TEST(accumulator_tests, family_128_and_256_constexpr_evaluation)
+{
+    constexpr std::array<int64_t, 4> values = { -1, std::numeric_limits<int64_t>::min(), std::numeric_limits<int64_t>::min(), 5 };
+    constexpr int128_t sum = accumulate<int128_t>(std::span<const int64_t>(values));
+
+    static_assert(sum == -int128_t(1) - (int128_t(1) << 64) + 5);
+
+    constexpr accumulator<int128_t> result = [&values]() {
+        accumulator<int128_t> result;
+
+        for (int64_t value : values)
+            result += value;
+
+        return result;
+    }();
+
+    static_assert(result.value() == sum);
+
+    constexpr int256_t product = dot_exact(std::span<const int64_t>(values), std::span<const int64_t>(values));
+
+    static_assert(product == int256_t(1) + (int256_t(1) << 127) + 25);
+}
+
+} // namespace slim
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// accumulator_tests.cpp
+////////////////////////////////////////////////////////////////////////////////////////////////////
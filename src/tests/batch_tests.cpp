@@ -0,0 +1,115 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// Simple Long Integer Math for C++
+// version 2.0
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// Licensed under the MIT License <http://opensource.org/licenses/MIT>.
+// SPDX-License-Identifier: MIT
+//
+// Copyright (c) 2020-2026 Yury Kalmykov <y_kalmykov@mail.ru>.
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "type_sets.h"
+
+#include <slimcpplib/long_batch.h>
+
+#include <gtest/gtest.h>
+
+#include <array>
+#include <vector>
+#include <random>
+
+namespace slim
+{
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// standalone functions
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+template<typename uint_t, slim::uint_t count>
+void run_batch_tests()
+{
+    using batch_t = long_uint_batch<native_word_t<uint_t>, word_count<uint_t>, count>;
+
+    std::mt19937_64 engine(41);
+
+    for (size_t n = 0; n < 100; ++n) {
+
+        std::array<uint_t, count> values1;
+        std::array<uint_t, count> values2;
+
+        for (slim::uint_t lane = 0; lane < count; ++lane) {
+
+            values1[lane] = make_random_value<uint_t>(engine, word_count<uint_t>, 2);
+            values2[lane] = lane % 3 == 0 ? values1[lane] : make_random_value<uint_t>(engine, word_count<uint_t>, 2);
+        }
+
+        const batch_t batch1(values1);
+        const batch_t batch2(values2);
+        const slim::uint_t shift = static_cast<slim::uint_t>(engine() % (bit_count_v<uint_t> + 8));
+
+        const batch_t sum = batch1 + batch2;
+        const batch_t difference = batch1 - batch2;
+        const batch_t product = mul_low(batch1, batch2);
+        const batch_t conjunction = batch1 & batch2;
+        const batch_t disjunction = batch1 | batch2;
+        const batch_t exclusion = batch1 ^ batch2;
+        const batch_t inversion = ~batch1;
+        const batch_t shifted_left = batch1 << shift;
+        const batch_t shifted_right = batch1 >> shift;
+        const std::array<int, count> order = compare(batch1, batch2);
+
+        // every lane matches scalar arithmetic
+
+        for (slim::uint_t lane = 0; lane < count; ++lane) {
+
+            const uint_t& value1 = values1[lane];
+            const uint_t& value2 = values2[lane];
+
+            ASSERT_EQ(batch1.get(lane), value1);
+            ASSERT_EQ(sum.get(lane), value1 + value2);
+            ASSERT_EQ(difference.get(lane), value1 - value2);
+            ASSERT_EQ(product.get(lane), value1 * value2);
+            ASSERT_EQ(conjunction.get(lane), value1 & value2);
+            ASSERT_EQ(disjunction.get(lane), value1 | value2);
+            ASSERT_EQ(exclusion.get(lane), value1 ^ value2);
+            ASSERT_EQ(inversion.get(lane), ~value1);
+            ASSERT_EQ(shifted_left.get(lane), shift < bit_count_v<uint_t> ? value1 << shift : uint_t(0));
+            ASSERT_EQ(shifted_right.get(lane), shift < bit_count_v<uint_t> ? value1 >> shift : uint_t(0));
+            ASSERT_EQ(order[lane], value1 < value2 ? -1 : value1 > value2 ? 1 : 0);
+        }
+
+        // scatter restores gathered values
+
+        std::array<uint_t, count> scattered;
+        product.scatter(scattered);
+
+        ASSERT_EQ(batch_t(scattered), product);
+    }
+
+    static_assert((batch_t(uint_t(5)) * batch_t(uint_t(7))).get(count - 1) == 35);
+    static_assert((batch_t(~uint_t(0)) + batch_t(uint_t(1))) == batch_t(uint_t(0)));
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// batch_tests
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+TEST(batch_tests, family_128_and_256_lane_arithmetic)
+{
+    run_batch_tests<uint128_t, 8>();
+    run_batch_tests<uint32x4_t, 16>();
+    run_batch_tests<uint256_t, 5>();
+    run_batch_tests<uint32x8_t, 8>();
+    run_batch_tests<uint64x4_t, 4>();
+}
+
+} // namespace slim
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// batch_tests.cpp
+////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,172 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// Simple Long Integer Math for C++
+// version 2.0
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// Licensed under the MIT License <http://opensource.org/licenses/MIT>.
+// SPDX-License-Identifier: MIT
+//
+// Copyright (c) 2020-2026 Yury Kalmykov <y_kalmykov@mail.ru>.
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "type_sets.h"
+
+#include <slimcpplib/long_bytes.h>
+
+#include <gtest/gtest.h>
+
+#include <array>
+#include <vector>
+
+namespace slim
+{
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// standalone functions
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+template<typename type_t>
+constexpr type_t make_byte_sequence() noexcept
+{
+    // byte n of the little-endian representation holds value n + 1
+
+    type_t result = 0;
+
+    for (size_t n = byte_count_v<type_t>; n > 0; --n)
+        result = (result << 8) | type_t(n);
+
+    return result;
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+template<typename type_t>
+constexpr bool check_bytes_round_trip(const type_t& value) noexcept
+{
+    std::array<std::byte, byte_count_v<type_t>> le_bytes;
+    std::array<std::byte, byte_count_v<type_t>> be_bytes;
+
+    to_bytes_le(value, le_bytes);
+    to_bytes_be(value, be_bytes);
+
+    return from_bytes_le<type_t>(le_bytes) == value && from_bytes_be<type_t>(be_bytes) == value;
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+template<typename uint_t>
+void run_byte_order_tests()
+{
+    constexpr size_t byte_count = byte_count_v<uint_t>;
+
+    static_assert(check_bytes_round_trip(make_byte_sequence<uint_t>()));
+    static_assert(check_bytes_round_trip(make_signed_t<uint_t>(-12345)));
+
+    const uint_t value = make_byte_sequence<uint_t>();
+    std::array<std::byte, byte_count> bytes;
+
+    to_bytes_le(value, bytes);
+
+    for (size_t n = 0; n < byte_count; ++n)
+        ASSERT_EQ(bytes[n], std::byte(n + 1));
+
+    ASSERT_EQ(from_bytes_le<uint_t>(bytes), value);
+
+    to_bytes_be(value, bytes);
+
+    for (size_t n = 0; n < byte_count; ++n)
+        ASSERT_EQ(bytes[n], std::byte(byte_count - n));
+
+    ASSERT_EQ(from_bytes_be<uint_t>(bytes), value);
+
+    // signed integers keep two's complement representation
+
+    using int_t = make_signed_t<uint_t>;
+
+    to_bytes_be(int_t(-2), bytes);
+
+    for (size_t n = 0; n + 1 < byte_count; ++n)
+        ASSERT_EQ(bytes[n], std::byte(0xff));
+
+    ASSERT_EQ(bytes[byte_count - 1], std::byte(0xfe));
+    ASSERT_EQ(from_bytes_be<int_t>(bytes), int_t(-2));
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+template<typename uint_t>
+void run_bulk_byte_order_tests()
+{
+    constexpr size_t byte_count = byte_count_v<uint_t>;
+    constexpr size_t value_count = 5;
+
+    std::vector<uint_t> values;
+
+    for (size_t n = 0; n < value_count; ++n)
+        values.push_back(make_byte_sequence<uint_t>() * uint_t(n + 3));
+
+    std::vector<std::byte> le_bytes(value_count * byte_count);
+    std::vector<std::byte> be_bytes(value_count * byte_count);
+
+    to_bytes_le(std::span<const uint_t>(values), le_bytes);
+    to_bytes_be(std::span(values), be_bytes);
+
+    // bulk output matches conversion of each value
+
+    for (size_t n = 0; n < value_count; ++n) {
+
+        std::array<std::byte, byte_count> bytes;
+
+        to_bytes_le(values[n], bytes);
+        ASSERT_TRUE(std::equal(bytes.begin(), bytes.end(), le_bytes.begin() + n * byte_count));
+
+        to_bytes_be(values[n], bytes);
+        ASSERT_TRUE(std::equal(bytes.begin(), bytes.end(), be_bytes.begin() + n * byte_count));
+    }
+
+    std::vector<uint_t> le_values(value_count);
+    std::vector<uint_t> be_values(value_count);
+
+    from_bytes_le(le_bytes, std::span(le_values));
+    from_bytes_be(be_bytes, std::span(be_values));
+
+    ASSERT_EQ(le_values, values);
+    ASSERT_EQ(be_values, values);
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// bytes_tests
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+TEST(bytes_tests, family_128_and_256_byte_order)
+{
+    run_byte_order_tests<uint128_t>();
+    run_byte_order_tests<uint32x4_t>();
+    run_byte_order_tests<uint256_t>();
+    run_byte_order_tests<uint32x8_t>();
+    run_byte_order_tests<uint64x4_t>();
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+TEST(bytes_tests, family_128_and_256_bulk_byte_order)
+{
+    run_bulk_byte_order_tests<uint128_t>();
+    run_bulk_byte_order_tests<uint32x4_t>();
+    run_bulk_byte_order_tests<uint256_t>();
+    run_bulk_byte_order_tests<uint64x4_t>();
+}
+
+} // namespace slim
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// bytes_tests.cpp
+////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,540 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// Simple Long Integer Math for C++
+// version 2.0
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// Licensed under the MIT License <http://opensource.org/licenses/MIT>.
+// SPDX-License-Identifier: MIT
+//
+// Copyright (c) 2020-2026 Yury Kalmykov <y_kalmykov@mail.ru>.
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "type_sets.h"
+
+#include <slimcpplib/long_charconv.h>
+
+#include <gtest/gtest.h>
+
+#include <array>
+#include <string>
+#include <string_view>
+
+namespace slim
+{
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// standalone functions
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+template<typename type_t>
+std::string format_value(const type_t& value, int base = 10)
+{
+    std::array<char, 300> buffer;
+    const std::to_chars_result result = to_chars(buffer.data(), buffer.data() + buffer.size(), value, base);
+
+    EXPECT_EQ(result.ec, std::errc());
+
+    return std::string(buffer.data(), result.ptr);
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+template<typename type_t>
+constexpr bool check_round_trip(const type_t& value, int base) noexcept
+{
+    std::array<char, 300> buffer {};
+    const std::to_chars_result to_result = to_chars(buffer.data(), buffer.data() + buffer.size(), value, base);
+
+    type_t parsed = 0;
+    const std::from_chars_result from_result = from_chars(buffer.data(), to_result.ptr, parsed, base);
+
+    return from_result.ec == std::errc() && from_result.ptr == to_result.ptr && parsed == value;
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+template<typename uint_t>
+void run_unsigned_to_chars_tests()
+{
+    static_assert(check_round_trip(uint_t(-1), 10));
+    static_assert(check_round_trip(uint_t(0), 2));
+
+    ASSERT_EQ(format_value(uint_t(0)), "0");
+    ASSERT_EQ(format_value(uint_t(0), 36), "0");
+    ASSERT_EQ(format_value(uint_t(255), 2), "11111111");
+    ASSERT_EQ(format_value(uint_t(255), 16), "ff");
+    ASSERT_EQ(format_value(uint_t(35), 36), "z");
+    ASSERT_EQ(format_value(uint_t(80), 3), "2222");
+    ASSERT_EQ(format_value(uint_t(1) << 64), "18446744073709551616");
+    ASSERT_EQ(format_value(uint_t(1) << 64, 8), "2000000000000000000000");
+    ASSERT_EQ(format_value(uint_t(-1), 2), std::string(bit_count_v<uint_t>, '1'));
+    ASSERT_EQ(format_value(uint_t(-1), 16), std::string(bit_count_v<uint_t> / 4, 'f'));
+
+    // base 32 digits span native digit boundaries
+
+    ASSERT_EQ(format_value(uint_t(-1), 32), std::string(1, "0137f"[bit_count_v<uint_t> % 5]) + std::string(bit_count_v<uint_t> / 5, 'v'));
+    ASSERT_EQ(format_value((uint_t(0x1f) << 62) | uint_t(5), 32), "3s" + std::string(11, '0') + "5");
+    ASSERT_EQ(format_value(uint_t(0123) << 63, 8), "123" + std::string(21, '0'));
+
+    // too small buffer reports value_too_large and returns the end of buffer
+
+    std::array<char, 4> buffer;
+    const std::to_chars_result result = to_chars(buffer.data(), buffer.data() + buffer.size(), uint_t(12345));
+
+    ASSERT_EQ(result.ec, std::errc::value_too_large);
+    ASSERT_EQ(result.ptr, buffer.data() + buffer.size());
+    ASSERT_EQ(to_chars(buffer.data(), buffer.data() + buffer.size(), uint_t(1234)).ptr, buffer.data() + 4);
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+template<typename uint_t>
+void run_decimal_split_tests()
+{
+    // powers of ten and their neighbours pad every split part with zeros or fill it with nines
+
+    uint_t power = 1;
+
+    for (size_t exponent = 0; exponent <= std::numeric_limits<uint_t>::digits10; ++exponent) {
+
+        // successor of power is built in place, string concatenation trips -Wrestrict of gcc 12
+
+        std::string successor(1, exponent > 0 ? '1' : '2');
+
+        if (exponent > 0) {
+
+            successor.append(exponent - 1, '0');
+            successor.append(1, '1');
+        }
+
+        ASSERT_EQ(format_value(power), "1" + std::string(exponent, '0'));
+        ASSERT_EQ(format_value(power + uint_t(1)), successor);
+
+        if (exponent > 0) {
+            ASSERT_EQ(format_value(power - uint_t(1)), std::string(exponent, '9'));
+        }
+
+        power *= uint_t(10);
+    }
+
+    ASSERT_EQ(format_value(uint_t(1234567890123456789ull) * uint_t(10000000000000000000ull) + uint_t(42)), "12345678901234567890000000000000000042");
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+template<typename uint_t, typename int_t>
+void run_signed_to_chars_tests()
+{
+    static_assert(check_round_trip(std::numeric_limits<int_t>::min(), 10));
+    static_assert(check_round_trip(int_t(-12345), 36));
+
+    ASSERT_EQ(format_value(int_t(0)), "0");
+    ASSERT_EQ(format_value(int_t(-1)), "-1");
+    ASSERT_EQ(format_value(int_t(-255), 16), "-ff");
+    ASSERT_EQ(format_value(std::numeric_limits<int_t>::min(), 2), "-1" + std::string(bit_count_v<int_t> - 1, '0'));
+    ASSERT_EQ(format_value(std::numeric_limits<int_t>::max()), format_value(uint_t(std::numeric_limits<int_t>::max())));
+
+    // the sign needs room too
+
+    std::array<char, 2> buffer;
+
+    ASSERT_EQ(to_chars(buffer.data(), buffer.data(), int_t(-1)).ec, std::errc::value_too_large);
+    ASSERT_EQ(to_chars(buffer.data(), buffer.data() + 1, int_t(-1)).ec, std::errc::value_too_large);
+    ASSERT_EQ(to_chars(buffer.data(), buffer.data() + 2, int_t(-1)).ec, std::errc());
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+template<typename uint_t>
+void run_unsigned_from_chars_tests()
+{
+    const auto parse = [](std::string_view text, uint_t& value, int base = 10) {
+        return from_chars(text.data(), text.data() + text.size(), value, base);
+    };
+
+    uint_t value = 7;
+
+    // the longest valid prefix is parsed, letters are case insensitive
+
+    std::string_view text = "00123xyz";
+    std::from_chars_result result = parse(text, value);
+
+    ASSERT_EQ(result.ec, std::errc());
+    ASSERT_EQ(result.ptr, text.data() + 5);
+    ASSERT_EQ(value, uint_t(123));
+
+    ASSERT_EQ(parse("FfEe", value, 16).ec, std::errc());
+    ASSERT_EQ(value, uint_t(0xffee));
+    ASSERT_EQ(parse("Zz", value, 36).ec, std::errc());
+    ASSERT_EQ(value, uint_t(36 * 35 + 35));
+    text = "1012";
+    ASSERT_EQ(parse(text, value, 2).ptr, text.data() + 3);
+    ASSERT_EQ(value, uint_t(5));
+
+    // no whitespace, plus sign, minus sign or prefix, value is left unchanged
+
+    for (std::string_view invalid : { "", " 1", "+1", "-1", "x" }) {
+
+        value = 7;
+        result = parse(invalid, value, 10);
+
+        ASSERT_EQ(result.ec, std::errc::invalid_argument) << invalid;
+        ASSERT_EQ(result.ptr, invalid.data()) << invalid;
+        ASSERT_EQ(value, uint_t(7)) << invalid;
+    }
+
+    // out of range consumes all digits and leaves value unchanged
+
+    const std::string max_text = format_value(uint_t(-1));
+    ASSERT_EQ(parse(max_text, value).ec, std::errc());
+    ASSERT_EQ(value, uint_t(-1));
+
+    value = 7;
+    const std::string over_text = format_value(uint_t(-1) / uint_t(10) + uint_t(1)) + "0;";
+    result = parse(over_text, value);
+
+    ASSERT_EQ(result.ec, std::errc::result_out_of_range);
+    ASSERT_EQ(result.ptr, over_text.data() + over_text.size() - 1);
+    ASSERT_EQ(value, uint_t(7));
+
+    const std::string long_text = "1" + std::string(bit_count_v<uint_t>, '0');
+    ASSERT_EQ(parse(long_text, value, 2).ec, std::errc::result_out_of_range);
+    ASSERT_EQ(parse(long_text.substr(1), value, 2).ec, std::errc());
+    ASSERT_EQ(value, uint_t(0));
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+template<typename uint_t>
+void run_eight_digit_from_chars_tests()
+{
+    const auto parse = [](std::string_view text, uint_t& value, int base) {
+        return from_chars(text.data(), text.data() + text.size(), value, base);
+    };
+
+    // every length around eight digit groups, checked against digit by digit accumulation
+
+    const std::string decimal_source = "9081726354453627180918273645546372819";
+    const std::string hex_source = "fEdCbA9876543210aBcDeF0123456789AbCdEf";
+
+    for (size_t length = 1; length <= decimal_source.size(); ++length) {
+
+        uint_t expected = 0;
+
+        for (size_t n = 0; n < length; ++n)
+            expected = expected * uint_t(10) + uint_t(decimal_source[n] - '0');
+
+        uint_t value = 0;
+        ASSERT_EQ(parse(std::string_view(decimal_source).substr(0, length), value, 10).ec, std::errc()) << length;
+        ASSERT_EQ(value, expected) << length;
+    }
+
+    for (size_t length = 1; length <= bit_count_v<uint_t> / 4; ++length) {
+
+        uint_t expected = 0;
+
+        for (size_t n = 0; n < length; ++n)
+            expected = (expected << 4) + uint_t(impl::char_to_digit(hex_source[n % hex_source.size()]));
+
+        std::string text;
+
+        for (size_t n = 0; n < length; ++n)
+            text += hex_source[n % hex_source.size()];
+
+        uint_t value = 0;
+        ASSERT_EQ(parse(text, value, 16).ec, std::errc()) << length;
+        ASSERT_EQ(value, expected) << length;
+    }
+
+    // characters next to digit ranges stop the group at the right place
+
+    for (const char stop : { '/', ':', '@', 'G', '`', 'g', ' ', '\x80', '\xb0' }) {
+
+        for (size_t position = 0; position < 16; ++position) {
+
+            std::string text = "1234567890abcdef1234";
+            text[position] = stop;
+
+            uint_t value = 7;
+            const std::from_chars_result result = parse(text, value, 16);
+
+            ASSERT_EQ(result.ptr, text.data() + position);
+
+            if (position > 0) {
+                ASSERT_EQ(format_value(value, 16), text.substr(0, position));
+            }
+
+            const size_t decimal_position = std::min<size_t>(position, 10);
+            ASSERT_EQ(parse(text, value, 10).ptr, text.data() + decimal_position);
+        }
+    }
+
+    // overflow is exact, leading zeros do not count
+
+    uint_t value = 7;
+    const std::string max_hex = std::string(bit_count_v<uint_t> / 4, 'F');
+
+    ASSERT_EQ(parse(std::string(40, '0') + max_hex, value, 16).ec, std::errc());
+    ASSERT_EQ(value, uint_t(-1));
+    ASSERT_EQ(parse("1" + std::string(bit_count_v<uint_t> / 4, '0'), value, 16).ec, std::errc::result_out_of_range);
+    ASSERT_EQ(parse("1" + std::string(bit_count_v<uint_t> - 1, '0'), value, 2).ec, std::errc());
+    ASSERT_EQ(value, uint_t(1) << (bit_count_v<uint_t> - 1));
+
+    const char top_octal_digit = char('0' + (1 << (bit_count_v<uint_t> % 3)) - 1);
+
+    ASSERT_EQ(parse(top_octal_digit + std::string(bit_count_v<uint_t> / 3, '7'), value, 8).ec, std::errc());
+    ASSERT_EQ(value, uint_t(-1));
+    ASSERT_EQ(parse(char(top_octal_digit + 1) + std::string(bit_count_v<uint_t> / 3, '0'), value, 8).ec, std::errc::result_out_of_range);
+    ASSERT_EQ(value, uint_t(-1));
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+template<typename int_t>
+void run_signed_from_chars_tests()
+{
+    const auto parse = [](std::string_view text, int_t& value, int base = 10) {
+        return from_chars(text.data(), text.data() + text.size(), value, base);
+    };
+
+    using uint_t = make_unsigned_t<int_t>;
+
+    int_t value = 7;
+
+    ASSERT_EQ(parse("-123", value).ec, std::errc());
+    ASSERT_EQ(value, int_t(-123));
+    ASSERT_EQ(parse("-0", value).ec, std::errc());
+    ASSERT_EQ(value, int_t(0));
+
+    // lone minus sign and plus sign are invalid
+
+    for (std::string_view invalid : { "-", "+1", "--1", "- 1" }) {
+
+        value = 7;
+        const std::from_chars_result result = parse(invalid, value);
+
+        ASSERT_EQ(result.ec, std::errc::invalid_argument) << invalid;
+        ASSERT_EQ(result.ptr, invalid.data()) << invalid;
+        ASSERT_EQ(value, int_t(7)) << invalid;
+    }
+
+    // range edges
+
+    const std::string min_text = format_value(std::numeric_limits<int_t>::min());
+    const std::string max_text = format_value(std::numeric_limits<int_t>::max());
+
+    ASSERT_EQ(parse(min_text, value).ec, std::errc());
+    ASSERT_EQ(value, std::numeric_limits<int_t>::min());
+    ASSERT_EQ(parse(max_text, value).ec, std::errc());
+    ASSERT_EQ(value, std::numeric_limits<int_t>::max());
+
+    value = 7;
+    const std::string above_max_text = format_value(uint_t(std::numeric_limits<int_t>::max()) + uint_t(1));
+    const std::from_chars_result result = parse(above_max_text, value);
+
+    ASSERT_EQ(result.ec, std::errc::result_out_of_range);
+    ASSERT_EQ(result.ptr, above_max_text.data() + above_max_text.size());
+    ASSERT_EQ(value, int_t(7));
+    ASSERT_EQ(parse("-" + format_value(uint_t(std::numeric_limits<int_t>::min()) + uint_t(1)), value).ec, std::errc::result_out_of_range);
+    ASSERT_EQ(value, int_t(7));
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+template<typename uint_t>
+void run_round_trip_tests()
+{
+    uint_t value = uint_t(0x0123456789abcdefull) * uint_t(0xfedcba9876543210ull);
+
+    for (int step = 0; step < 16; ++step) {
+
+        for (int base = 2; base <= 36; ++base) {
+
+            ASSERT_TRUE(check_round_trip(value, base)) << base;
+            ASSERT_TRUE(check_round_trip(make_signed_t<uint_t>(value), base)) << base;
+        }
+
+        value = value * value + uint_t(step);
+    }
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+template<typename uint_t>
+void run_parse_tests()
+{
+    using int_t = make_signed_t<uint_t>;
+
+    static_assert(parse<uint_t>("0xff'ff").value == 0xffffU);
+    static_assert(parse<int_t>("-1'000").value == int_t(-1000));
+    static_assert(parse<uint_t>("0x").ec == std::errc::invalid_argument);
+
+    // base detection and separators
+
+    ASSERT_EQ(parse<uint_t>("123'456").value, 123456U);
+    ASSERT_EQ(parse<uint_t>("0x1F").value, 31U);
+    ASSERT_EQ(parse<uint_t>("0B1010").value, 10U);
+    ASSERT_EQ(parse<uint_t>("017").value, 15U);
+    ASSERT_EQ(parse<uint_t>("0'7").value, 7U);
+    ASSERT_EQ(parse<uint_t>("0").value, 0U);
+    ASSERT_EQ(parse<uint_t>("0x0000").value, 0U);
+    ASSERT_EQ(parse<uint_t>("42").ec, std::errc());
+    ASSERT_EQ(parse<uint_t>("42").position, 2U);
+
+    // syntax errors point to the unexpected character
+
+    const auto check_error = [](std::string_view text, std::errc ec, size_t position) {
+
+        const parse_result_t<uint_t> result = parse<uint_t>(text);
+
+        ASSERT_EQ(result.ec, ec) << text;
+        ASSERT_EQ(result.position, position) << text;
+        ASSERT_EQ(result.value, 0U) << text;
+    };
+
+    check_error("", std::errc::invalid_argument, 0);
+    check_error("0x", std::errc::invalid_argument, 2);
+    check_error("12a", std::errc::invalid_argument, 2);
+    check_error("1''2", std::errc::invalid_argument, 1);
+    check_error("'1", std::errc::invalid_argument, 0);
+    check_error("1'", std::errc::invalid_argument, 1);
+    check_error("0x'1", std::errc::invalid_argument, 2);
+    check_error("08", std::errc::invalid_argument, 1);
+    check_error("0b102", std::errc::invalid_argument, 4);
+    check_error("-1", std::errc::invalid_argument, 0);
+    check_error(" 1", std::errc::invalid_argument, 0);
+
+    // overflow points to the first digit, that doesn't fit
+
+    const std::string max_hex = "0x" + std::string(bit_count_v<uint_t> / 4, 'f');
+
+    ASSERT_EQ(parse<uint_t>(max_hex).value, ~uint_t(0U));
+    check_error("0x1" + max_hex.substr(2), std::errc::result_out_of_range, max_hex.size());
+    check_error("0x00'" + max_hex.substr(2) + "'0", std::errc::result_out_of_range, max_hex.size() + 4);
+
+    std::array<char, bit_count_v<uint_t>> buffer;
+    std::string max_dec(buffer.data(), to_chars(buffer.data(), buffer.data() + buffer.size(), ~uint_t(0U)).ptr);
+
+    ASSERT_EQ(parse<uint_t>(max_dec).value, ~uint_t(0U));
+    ++max_dec.back();
+    check_error(max_dec, std::errc::result_out_of_range, max_dec.size() - 1);
+
+    // signed range is asymmetric
+
+    const int_t min_value = std::numeric_limits<int_t>::min();
+    std::string min_dec(buffer.data(), to_chars(buffer.data(), buffer.data() + buffer.size(), min_value).ptr);
+
+    ASSERT_EQ(parse<int_t>(min_dec).value, min_value);
+    ASSERT_EQ(parse<int_t>("-0x8" + std::string(bit_count_v<uint_t> / 4 - 1, '0')).value, min_value);
+    ASSERT_EQ(parse<int_t>(min_dec.substr(1)).ec, std::errc::result_out_of_range);
+    ASSERT_EQ(parse<int_t>(min_dec.substr(1)).position, min_dec.size() - 2);
+    ASSERT_EQ(parse<int_t>("-").ec, std::errc::invalid_argument);
+    ASSERT_EQ(parse<int_t>("-").position, 1U);
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// charconv_tests
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+TEST(charconv_tests, family_128_and_256_unsigned_to_chars)
+{
+    run_unsigned_to_chars_tests<uint128_t>();
+    run_unsigned_to_chars_tests<uint32x4_t>();
+    run_unsigned_to_chars_tests<uint256_t>();
+    run_unsigned_to_chars_tests<uint32x8_t>();
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+TEST(charconv_tests, family_128_and_256_decimal_split)
+{
+    run_decimal_split_tests<uint128_t>();
+    run_decimal_split_tests<uint32x4_t>();
+    run_decimal_split_tests<uint256_t>();
+    run_decimal_split_tests<uint32x8_t>();
+    run_decimal_split_tests<uint64x4_t>();
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+TEST(charconv_tests, family_128_and_256_signed_to_chars)
+{
+    run_signed_to_chars_tests<uint128_t, int128_t>();
+    run_signed_to_chars_tests<uint32x4_t, int32x4_t>();
+    run_signed_to_chars_tests<uint256_t, int256_t>();
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+TEST(charconv_tests, family_128_and_256_unsigned_from_chars)
+{
+    run_unsigned_from_chars_tests<uint128_t>();
+    run_unsigned_from_chars_tests<uint32x4_t>();
+    run_unsigned_from_chars_tests<uint256_t>();
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+TEST(charconv_tests, family_128_and_256_eight_digit_from_chars)
+{
+    run_eight_digit_from_chars_tests<uint128_t>();
+    run_eight_digit_from_chars_tests<uint32x4_t>();
+    run_eight_digit_from_chars_tests<uint256_t>();
+    run_eight_digit_from_chars_tests<uint32x8_t>();
+    run_eight_digit_from_chars_tests<uint64x4_t>();
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+TEST(charconv_tests, family_128_and_256_signed_from_chars)
+{
+    run_signed_from_chars_tests<int128_t>();
+    run_signed_from_chars_tests<int32x4_t>();
+    run_signed_from_chars_tests<int256_t>();
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+TEST(charconv_tests, family_128_and_256_round_trip_all_bases)
+{
+    run_round_trip_tests<uint128_t>();
+    run_round_trip_tests<uint32x4_t>();
+    run_round_trip_tests<uint256_t>();
+    run_round_trip_tests<uint64x4_t>();
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+TEST(charconv_tests, family_128_and_256_parse)
+{
+    run_parse_tests<uint128_t>();
+    run_parse_tests<uint32x4_t>();
+    run_parse_tests<uint256_t>();
+    run_parse_tests<uint64x4_t>();
+}
+
+} // namespace slim
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// charconv_tests.cpp
+////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,182 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// Simple Long Integer Math for C++
+// version 2.0
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// Licensed under the MIT License <http://opensource.org/licenses/MIT>.
+// SPDX-License-Identifier: MIT
+//
+// Copyright (c) 2020-2026 Yury Kalmykov <y_kalmykov@mail.ru>.
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "type_sets.h"
+
+#include <gtest/gtest.h>
+
+#include <compare>
+#include <limits>
+#include <random>
+
+namespace slim
+{
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// standalone functions
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+template<typename type_t>
+type_t make_compare_value(std::mt19937_64& engine)
+{
+    using native_t = native_word_t<type_t>;
+
+    typename type_t::native_array_t digits{};
+
+    // share most digits between values so that lower digits decide the order as well
+
+    for (native_t& digit : digits)
+        digit = static_cast<native_t>(engine() % 3);
+
+    return type_t(digits);
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+template<typename uint_t>
+void run_unsigned_three_way_tests()
+{
+    static_assert((uint_t(1) <=> uint_t(2)) == std::strong_ordering::less);
+    static_assert((uint_t(2) <=> uint_t(2)) == std::strong_ordering::equal);
+    static_assert(((uint_t(1) << 100) <=> uint_t(-1)) == std::strong_ordering::less);
+    static_assert((uint_t(-1) <=> uint_t(0)) == std::strong_ordering::greater);
+
+    // the most significant differing digit decides
+
+    ASSERT_EQ(((uint_t(1) << 64) <=> uint_t(std::numeric_limits<uint64_t>::max())), std::strong_ordering::greater);
+    ASSERT_EQ(((uint_t(1) << 64) + uint_t(1) <=> (uint_t(1) << 64) + uint_t(2)), std::strong_ordering::less);
+
+    // three-way result agrees with the relational operators
+
+    std::mt19937_64 engine(27);
+
+    for (size_t n = 0; n < 1000; ++n) {
+
+        const uint_t lhs = make_compare_value<uint_t>(engine);
+        const uint_t rhs = make_compare_value<uint_t>(engine);
+        const std::strong_ordering order = lhs <=> rhs;
+
+        ASSERT_EQ(order < 0, lhs < rhs);
+        ASSERT_EQ(order == 0, lhs == rhs);
+        ASSERT_EQ(order > 0, lhs > rhs);
+        ASSERT_EQ(rhs <=> lhs, 0 <=> order);
+    }
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+template<typename int_t>
+void run_signed_three_way_tests()
+{
+    static_assert((int_t(-1) <=> int_t(0)) == std::strong_ordering::less);
+    static_assert((int_t(-1) <=> int_t(-2)) == std::strong_ordering::greater);
+    static_assert((std::numeric_limits<int_t>::min() <=> std::numeric_limits<int_t>::max()) == std::strong_ordering::less);
+
+    // sign of the most significant digit overrides lower digits
+
+    ASSERT_EQ((int_t(-1) <=> int_t(1)), std::strong_ordering::less);
+    ASSERT_EQ((-(int_t(1) << 70) <=> int_t(-1)), std::strong_ordering::less);
+    ASSERT_EQ(((int_t(1) << 70) <=> int_t(-1)), std::strong_ordering::greater);
+
+    std::mt19937_64 engine(28);
+
+    for (size_t n = 0; n < 1000; ++n) {
+
+        const int_t lhs = make_compare_value<int_t>(engine) - (int_t(1) << (bit_count_v<int_t> - 2));
+        const int_t rhs = make_compare_value<int_t>(engine) - (int_t(1) << (bit_count_v<int_t> - 2));
+        const std::strong_ordering order = lhs <=> rhs;
+
+        ASSERT_EQ(order < 0, lhs < rhs);
+        ASSERT_EQ(order == 0, lhs == rhs);
+        ASSERT_EQ(order > 0, lhs > rhs);
+    }
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+template<typename uint_t, typename int_t>
+void run_mixed_native_three_way_tests()
+{
+    static_assert((uint_t(5) <=> 5u) == std::strong_ordering::equal);
+    static_assert((uint_t(5) <=> 7) == std::strong_ordering::less);
+    static_assert((7 <=> uint_t(5)) == std::strong_ordering::greater);
+    static_assert((int_t(-5) <=> -5) == std::strong_ordering::equal);
+    static_assert((int_t(-5) <=> 3u) == std::strong_ordering::less);
+
+    // unsigned values compare with negative natives as with all upper bits set
+
+    ASSERT_EQ((uint_t(-1) <=> -1), std::strong_ordering::equal);
+    ASSERT_EQ((uint_t(5) <=> -1), std::strong_ordering::less);
+    ASSERT_EQ(((uint_t(1) << 64) <=> 1u), std::strong_ordering::greater);
+
+    // signed values compare by value with both signed and unsigned natives
+
+    ASSERT_EQ((int_t(-1) <=> -2), std::strong_ordering::greater);
+    ASSERT_EQ((int_t(-1) <=> 0u), std::strong_ordering::less);
+    ASSERT_EQ((std::numeric_limits<int_t>::min() <=> std::numeric_limits<int32_t>::min()), std::strong_ordering::less);
+    ASSERT_EQ((-(int_t(1) << 80) <=> -1), std::strong_ordering::less);
+    ASSERT_EQ(((int_t(1) << 80) <=> 1), std::strong_ordering::greater);
+
+    // relational operators with natives pick the three-way result
+
+    ASSERT_TRUE(int_t(-1) < 0);
+    ASSERT_TRUE(-2 < int_t(-1));
+    ASSERT_TRUE(int_t(-1) < 1u);
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// compare_tests
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+TEST(compare_tests, family_128_and_256_unsigned_three_way)
+{
+    run_unsigned_three_way_tests<uint128_t>();
+    run_unsigned_three_way_tests<uint32x4_t>();
+    run_unsigned_three_way_tests<uint256_t>();
+    run_unsigned_three_way_tests<uint32x8_t>();
+    run_unsigned_three_way_tests<uint64x4_t>();
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+TEST(compare_tests, family_128_and_256_signed_three_way)
+{
+    run_signed_three_way_tests<int128_t>();
+    run_signed_three_way_tests<int32x4_t>();
+    run_signed_three_way_tests<int256_t>();
+    run_signed_three_way_tests<int32x8_t>();
+    run_signed_three_way_tests<int64x4_t>();
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+TEST(compare_tests, family_128_and_256_mixed_native_three_way)
+{
+    run_mixed_native_three_way_tests<uint128_t, int128_t>();
+    run_mixed_native_three_way_tests<uint32x4_t, int32x4_t>();
+    run_mixed_native_three_way_tests<uint256_t, int256_t>();
+    run_mixed_native_three_way_tests<uint64x4_t, int64x4_t>();
+}
+
+} // namespace slim
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// compare_tests.cpp
+////////////////////////////////////////////////////////////////////////////////////////////////////
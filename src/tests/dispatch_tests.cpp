@@ -0,0 +1,167 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// Simple Long Integer Math for C++
+// version 2.0
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// Licensed under the MIT License <http://opensource.org/licenses/MIT>.
+// SPDX-License-Identifier: MIT
+//
+// Copyright (c) 2020-2026 Yury Kalmykov <y_kalmykov@mail.ru>.
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "type_sets.h"
+
+#include <slimcpplib/long_dispatch.h>
+
+#include <gtest/gtest.h>
+
+#include <array>
+#include <cstdlib>
+#include <random>
+#include <string_view>
+#include <vector>
+
+namespace slim
+{
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// standalone functions
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void set_isa_variable(const char* value)
+{
+#ifdef _WIN32
+    _putenv_s("SLIMCPP_ISA", value != nullptr ? value : "");
+#else
+    if (value != nullptr)
+        setenv("SLIMCPP_ISA", value, 1);
+    else
+        unsetenv("SLIMCPP_ISA");
+#endif
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+template<typename type_t>
+void run_dispatch_tests(isa_t level)
+{
+    const dispatch_table_t<type_t> table = make_dispatch_table<type_t>(level);
+
+    ASSERT_EQ(table.level, std::min(level, detected_isa()));
+
+    std::mt19937_64 engine(44);
+
+    constexpr size_t count = 29;
+    std::vector<type_t> values1(count);
+    std::vector<type_t> values2(count);
+
+    // divisors of every length, so that both short and long division are used
+
+    for (size_t n = 0; n < count; ++n) {
+
+        values1[n] = make_random_value<type_t>(engine, word_count<type_t>, 0, true);
+        values2[n] = make_random_value<type_t>(engine, word_count<type_t>, 0, true) | type_t(1U);
+    }
+
+    // scalar kernels give the same results as operators and to_chars()
+
+    for (size_t n = 0; n < count; ++n) {
+
+        const type_t& value1 = values1[n];
+        const type_t& value2 = values2[n];
+
+        ASSERT_EQ(table.mul(value1, value2), value1 * value2);
+        ASSERT_EQ(table.div(value1, value2), value1 / value2);
+        ASSERT_EQ(table.mod(value1, value2), value1 % value2);
+
+        for (int base : {2, 10, 16}) {
+
+            std::array<char, bit_count_v<type_t> + 1> expected;
+            std::array<char, bit_count_v<type_t> + 1> actual;
+
+            const std::to_chars_result expected_result = to_chars(expected.data(), expected.data() + expected.size(), value1, base);
+            const std::to_chars_result actual_result = table.to_chars(actual.data(), actual.data() + actual.size(), value1, base);
+
+            ASSERT_EQ(actual_result.ec, expected_result.ec);
+            ASSERT_EQ(std::string_view(actual.data(), actual_result.ptr), std::string_view(expected.data(), expected_result.ptr));
+        }
+    }
+
+    // array kernels as well
+
+    std::vector<type_t> results(count);
+
+    table.add_n(results, values1, values2);
+
+    for (size_t n = 0; n < count; ++n)
+        ASSERT_EQ(results[n], values1[n] + values2[n]);
+
+    table.sub_n(results, values1, values2);
+
+    for (size_t n = 0; n < count; ++n)
+        ASSERT_EQ(results[n], values1[n] - values2[n]);
+
+    table.mul_n(results, values1, values2);
+
+    for (size_t n = 0; n < count; ++n)
+        ASSERT_EQ(results[n], values1[n] * values2[n]);
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// dispatch_tests
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+TEST(dispatch_tests, isa_selection)
+{
+    static_assert(parse_isa("baseline") == isa_t::baseline);
+    static_assert(parse_isa("avx512ifma") == isa_t::avx512ifma);
+    static_assert(!parse_isa("avx"));
+    static_assert(isa_name(isa_t::avx2) == "avx2");
+
+    const isa_t detected = detected_isa();
+
+    EXPECT_LE(isa(), detected);
+
+    // environment variable lowers the level, but never raises it above the detected one
+
+    set_isa_variable("baseline");
+    EXPECT_EQ(impl::select_isa(), isa_t::baseline);
+
+    set_isa_variable("avx512ifma");
+    EXPECT_EQ(impl::select_isa(), detected);
+
+    set_isa_variable("unknown");
+    EXPECT_EQ(impl::select_isa(), detected);
+
+    set_isa_variable(nullptr);
+    EXPECT_EQ(impl::select_isa(), detected);
+
+    EXPECT_EQ(dispatch_table<uint128_t>().level, isa());
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+TEST(dispatch_tests, family_128_and_256_all_levels)
+{
+    for (isa_t level : {isa_t::baseline, isa_t::avx2, isa_t::avx512, isa_t::avx512ifma}) {
+
+        run_dispatch_tests<uint128_t>(level);
+        run_dispatch_tests<int128_t>(level);
+        run_dispatch_tests<uint32x4_t>(level);
+        run_dispatch_tests<uint256_t>(level);
+        run_dispatch_tests<int256_t>(level);
+        run_dispatch_tests<uint32x8_t>(level);
+    }
+}
+
+} // namespace slim
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// dispatch_tests.cpp
+////////////////////////////////////////////////////////////////////////////////////////////////////
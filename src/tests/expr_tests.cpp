@@ -0,0 +1,160 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// Simple Long Integer Math for C++
+// version 2.0
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// Licensed under the MIT License <http://opensource.org/licenses/MIT>.
+// SPDX-License-Identifier: MIT
+//
+// Copyright (c) 2020-2026 Yury Kalmykov <y_kalmykov@mail.ru>.
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "type_sets.h"
+
+#include <slimcpplib/long_expr.h>
+
+#include <gtest/gtest.h>
+
+namespace slim
+{
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// standalone functions
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+template<typename uint_t>
+void run_unsigned_fused_expression_tests()
+{
+    using expr::lazy;
+
+    constexpr uint_t max = uint_t(-1);
+    constexpr uint_t half = max >> 1;
+
+    // a * b / c keeps the full product
+
+    static_assert(uint_t(lazy(max) * uint_t(6) / uint_t(12)) == half);
+    static_assert(uint_t(lazy(half) * 4 / 8) == half / 2);
+
+    const uint_t quotient = lazy(max) * max / max;
+    ASSERT_EQ(quotient, max);
+    ASSERT_EQ(quotient, muldiv(max, max, max));
+
+    // a * b + c and c + a * b
+
+    static_assert(uint_t(lazy(uint_t(7)) * 6 + 5) == uint_t(47));
+    static_assert(uint_t(5 + lazy(uint_t(7)) * 6) == uint_t(47));
+
+    const uint_t value1 = (uint_t(0x123456789abcdefull) << 70) + uint_t(0xfedcba987654321ull);
+    const uint_t value2 = (uint_t(0x0f1e2d3c4b5a6978ull) << 40) + uint_t(3);
+    const uint_t addend = max - uint_t(12345);
+
+    ASSERT_EQ(uint_t(lazy(value1) * value2 + addend), value1 * value2 + addend);
+    ASSERT_EQ(uint_t(addend + lazy(value1) * value2), value1 * value2 + addend);
+    ASSERT_EQ(muladd(value1, value2, addend), value1 * value2 + addend);
+
+    // (a + b) >> k keeps the carry
+
+    static_assert(uint_t((lazy(max) + max) >> 1) == max);
+    static_assert(uint_t((lazy(uint_t(10)) + 6) >> 2) == uint_t(4));
+
+    ASSERT_EQ(uint_t((lazy(max) + uint_t(1)) >> 1), uint_t(1) << (bit_count_v<uint_t> - 1));
+    ASSERT_EQ(uint_t((lazy(max) + max) >> 0), max - uint_t(1));
+    ASSERT_EQ(addshr(max, uint_t(1), bit_count_v<uint_t>), uint_t(1));
+    ASSERT_EQ(addshr(max, uint_t(0), bit_count_v<uint_t>), uint_t(0));
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+template<typename uint_t>
+void run_unsigned_generic_expression_tests()
+{
+    using expr::lazy;
+
+    const uint_t value1 = (uint_t(0xabcdefull) << 90) + uint_t(0x12345ull);
+    const uint_t value2 = (uint_t(0x3579bdfull) << 20) + uint_t(7);
+
+    // patterns without fused kernels evaluate step by step
+
+    ASSERT_EQ(uint_t(lazy(value1) - value2), value1 - value2);
+    ASSERT_EQ(uint_t(lazy(value1) % value2), value1 % value2);
+    ASSERT_EQ(uint_t(lazy(value1) / value2), value1 / value2);
+    ASSERT_EQ(uint_t((lazy(value1) - value2) << 3), (value1 - value2) << 3);
+    ASSERT_EQ(uint_t((lazy(value1) - value2) >> 3), (value1 - value2) >> 3);
+    ASSERT_EQ(uint_t(value1 - lazy(value2) * 3), value1 - value2 * uint_t(3));
+
+    // nested expressions with fused parts
+
+    ASSERT_EQ(uint_t((lazy(value1) * value2 + value1) / value2), (value1 * value2 + value1) / value2);
+    ASSERT_EQ(expr::eval(lazy(value1) * value2 / value2), value1);
+
+    // assignment evaluates the expression
+
+    uint_t result;
+    result = lazy(value2) * 2 + value1;
+    ASSERT_EQ(result, value2 * uint_t(2) + value1);
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+template<typename int_t>
+void run_signed_expression_tests()
+{
+    using expr::lazy;
+
+    constexpr int_t max = std::numeric_limits<int_t>::max();
+
+    static_assert(int_t(lazy(max) * -4 / 8) == -(max / 2));
+    static_assert(int_t(lazy(int_t(-7)) * 6 + 5) == int_t(-37));
+
+    const int_t value1 = -(int_t(0x123456789ull) << 80) + int_t(77);
+    const int_t value2 = (int_t(0x987654321ull) << 10) - int_t(3);
+
+    ASSERT_EQ(int_t(lazy(value1) * value2 + value1), value1 * value2 + value1);
+    ASSERT_EQ(int_t(lazy(value1) * value2 / value2), value1);
+    ASSERT_EQ(int_t(lazy(max) * max / max), max);
+    ASSERT_EQ(int_t(lazy(value1) - value2), value1 - value2);
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// expr_tests
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+TEST(expr_tests, family_128_and_256_unsigned_fused)
+{
+    run_unsigned_fused_expression_tests<uint128_t>();
+    run_unsigned_fused_expression_tests<uint32x4_t>();
+    run_unsigned_fused_expression_tests<uint256_t>();
+    run_unsigned_fused_expression_tests<uint64x4_t>();
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+TEST(expr_tests, family_128_and_256_unsigned_generic)
+{
+    run_unsigned_generic_expression_tests<uint128_t>();
+    run_unsigned_generic_expression_tests<uint32x4_t>();
+    run_unsigned_generic_expression_tests<uint256_t>();
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+TEST(expr_tests, family_128_and_256_signed)
+{
+    run_signed_expression_tests<int128_t>();
+    run_signed_expression_tests<int32x4_t>();
+    run_signed_expression_tests<int256_t>();
+}
+
+} // namespace slim
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// expr_tests.cpp
+////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,141 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// Simple Long Integer Math for C++
+// version 2.0
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// Licensed under the MIT License <http://opensource.org/licenses/MIT>.
+// SPDX-License-Identifier: MIT
+//
+// Copyright (c) 2020-2026 Yury Kalmykov <y_kalmykov@mail.ru>.
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+#include "type_sets.h"
+
+#include <slimcpplib/long_flat_map.h>
+
+#include <gtest/gtest.h>
+
+#include <unordered_map>
+#include <vector>
+#include <random>
+
+namespace slim
+{
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// standalone functions
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+template<typename key_t>
+void run_flat_map_tests()
+{
+    std::mt19937_64 engine(50);
+
+    flat_map<key_t, uint32_t> map;
+    std::unordered_map<key_t, uint32_t> expected;
+
+    EXPECT_EQ(map.find(key_t(0)), nullptr);
+    EXPECT_FALSE(map.erase(key_t(0)));
+
+    // keys from a small range make inserts of present keys and erases frequent, so that deleted
+    // slots are reused and dropped by rehashing
+
+    for (uint32_t n = 0; n < 200000; ++n) {
+
+        const key_t key = (key_t(engine() % 4096) << (bit_count_v<key_t> - 16)) ^ key_t(engine() % 4);
+        const uint64_t operation = engine() % 8;
+
+        if (operation < 4) {
+
+            const auto [value, inserted] = map.insert(key, n);
+            const auto [expected_value, expected_inserted] = expected.insert({ key, n });
+
+            ASSERT_EQ(inserted, expected_inserted);
+            ASSERT_EQ(*value, expected_value->second);
+
+        } else if (operation < 6) {
+
+            ASSERT_EQ(map.erase(key), expected.erase(key) != 0);
+
+        } else if (operation < 7) {
+
+            map[key] += 1;
+            expected[key] += 1;
+
+        } else {
+
+            const uint32_t* value = map.find(key);
+            const auto expected_value = expected.find(key);
+
+            ASSERT_EQ(value != nullptr, expected_value != expected.end());
+
+            if (value != nullptr) {
+                ASSERT_EQ(*value, expected_value->second);
+            }
+        }
+
+        ASSERT_EQ(map.size(), expected.size());
+    }
+
+    size_t visited = 0;
+
+    map.for_each([&](const key_t& key, uint32_t value) {
+
+        ++visited;
+        EXPECT_EQ(expected.at(key), value);
+    });
+
+    EXPECT_EQ(visited, expected.size());
+    EXPECT_LE(map.size() * 8, map.capacity() * 7);
+
+    map.clear();
+    EXPECT_TRUE(map.empty());
+    EXPECT_FALSE(map.contains(expected.begin()->first));
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// flat_map_tests
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+TEST(flat_map_tests, family_128_and_256_random_operations)
+{
+    run_flat_map_tests<uint128_t>();
+    run_flat_map_tests<int128_t>();
+    run_flat_map_tests<uint256_t>();
+    run_flat_map_tests<uint32x4_t>();
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+TEST(flat_map_tests, family_128_reserve_and_all_key_values)
+{
+    flat_map<uint128_t, int> map(1000);
+    const size_t capacity = map.capacity();
+
+    EXPECT_GE(capacity * 7, 1000u * 8);
+
+    // zero and all ones are ordinary keys, reserved space is enough for all of them
+
+    for (int n = 0; n < 1000; ++n)
+        map.insert(n % 2 == 0 ? uint128_t(n) : ~uint128_t(n), n);
+
+    EXPECT_EQ(map.capacity(), capacity);
+    EXPECT_EQ(map.size(), 1000u);
+    ASSERT_NE(map.find(uint128_t(0)), nullptr);
+    EXPECT_EQ(*map.find(uint128_t(0)), 0);
+    ASSERT_NE(map.find(~uint128_t(1)), nullptr);
+    EXPECT_EQ(*map.find(~uint128_t(1)), 1);
+    EXPECT_EQ(map.find(uint128_t(1)), nullptr);
+}
+
+} // namespace slim
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// flat_map_tests.cpp
+////////////////////////////////////////////////////////////////////////////////////////////////////
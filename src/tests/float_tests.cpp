@@ -0,0 +1,231 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// Simple Long Integer Math for C++
+// version 2.0
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// Licensed under the MIT License <http://opensource.org/licenses/MIT>.
+// SPDX-License-Identifier: MIT
+//
+// Copyright (c) 2020-2026 Yury Kalmykov <y_kalmykov@mail.ru>.
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "type_sets.h"
+
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <limits>
+
+namespace slim
+{
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// standalone functions
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+template<typename uint_t>
+void run_unsigned_to_double_rounding_tests()
+{
+    // small values convert exactly
+
+    static_assert(to_double(uint_t(0)) == 0.0);
+    static_assert(to_double(uint_t(12345)) == 12345.0);
+    static_assert(static_cast<double>(uint_t(1) << 100) == 0x1p100);
+
+    ASSERT_EQ(to_double(uint_t(0)), 0.0);
+    ASSERT_EQ(to_double(uint_t(12345)), 12345.0);
+    ASSERT_EQ(static_cast<double>(uint_t(1) << 100), std::ldexp(1.0, 100));
+
+    // hi * 2^64 + lo double-rounds this value down, correct rounding goes up
+
+    const uint_t double_rounding = (uint_t(1) << 64) + (uint_t(1) << 63) + (uint_t(1) << 11) + uint_t(1);
+
+    ASSERT_EQ(to_double(double_rounding), std::ldexp(1.0, 64) + std::ldexp(1.0, 63) + std::ldexp(1.0, 12));
+
+    // ties round to even mantissa
+
+    ASSERT_EQ(to_double((uint_t(1) << 53) + uint_t(1)), std::ldexp(1.0, 53));
+    ASSERT_EQ(to_double((uint_t(1) << 53) + uint_t(3)), std::ldexp(1.0, 53) + 4.0);
+    ASSERT_EQ(to_double((uint_t(1) << 117) + (uint_t(1) << 64)), std::ldexp(1.0, 117));
+    ASSERT_EQ(to_double((uint_t(1) << 117) + (uint_t(1) << 64) + uint_t(1)), std::ldexp(1.0, 117) + std::ldexp(1.0, 65));
+
+    // all ones round up to the next power of two
+
+    ASSERT_EQ(to_double(uint_t(-1)), std::ldexp(1.0, static_cast<int>(bit_count_v<uint_t>)));
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+template<typename uint_t>
+void run_unsigned_to_float_tests()
+{
+    static_assert(to_float(uint_t(1) << 24) == 0x1p24f);
+
+    ASSERT_EQ(to_float((uint_t(1) << 24) + uint_t(1)), std::ldexp(1.0f, 24));
+    ASSERT_EQ(to_float((uint_t(1) << 24) + uint_t(3)), std::ldexp(1.0f, 24) + 4.0f);
+    ASSERT_EQ(to_float((uint_t(1) << 100) + (uint_t(1) << 76) + uint_t(1)), std::ldexp(1.0f, 100) + std::ldexp(1.0f, 77));
+
+    // rounding beyond the float range produces infinity
+
+    ASSERT_EQ(to_float(uint_t(-1)), std::numeric_limits<float>::infinity());
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+template<typename uint_t>
+void run_unsigned_to_long_double_tests()
+{
+    ASSERT_EQ(to_long_double(uint_t(12345)), 12345.0L);
+    ASSERT_EQ(to_long_double(uint_t(1) << 120), std::ldexp(1.0L, 120));
+
+    if constexpr (std::numeric_limits<long double>::digits == 64) {
+
+        ASSERT_EQ(to_long_double((uint_t(1) << 64) + uint_t(1)), std::ldexp(1.0L, 64));
+        ASSERT_EQ(to_long_double((uint_t(1) << 64) + uint_t(3)), std::ldexp(1.0L, 64) + 4.0L);
+    }
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+template<typename uint_t, typename int_t>
+void run_signed_to_floating_tests()
+{
+    static_assert(to_double(int_t(-12345)) == -12345.0);
+    static_assert(static_cast<double>(int_t(-1)) == -1.0);
+
+    const uint_t double_rounding = (uint_t(1) << 64) + (uint_t(1) << 63) + (uint_t(1) << 11) + uint_t(1);
+    const double expected = std::ldexp(1.0, 64) + std::ldexp(1.0, 63) + std::ldexp(1.0, 12);
+
+    ASSERT_EQ(to_double(int_t(double_rounding)), expected);
+    ASSERT_EQ(to_double(-int_t(double_rounding)), -expected);
+    ASSERT_EQ(static_cast<float>(-int_t(double_rounding)), -static_cast<float>(expected));
+
+    // extreme values
+
+    ASSERT_EQ(to_double(std::numeric_limits<int_t>::min()), -std::ldexp(1.0, static_cast<int>(bit_count_v<int_t>) - 1));
+    ASSERT_EQ(to_double(std::numeric_limits<int_t>::max()), std::ldexp(1.0, static_cast<int>(bit_count_v<int_t>) - 1));
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+template<typename uint_t>
+void run_unsigned_from_floating_tests()
+{
+    static_assert(from_double<uint_t>(123.9) == uint_t(123));
+    static_assert(from_floating<uint_t>(0x1p100f) == uint_t(1) << 100);
+
+    ASSERT_EQ(from_double<uint_t>(0.0), uint_t(0));
+    ASSERT_EQ(from_double<uint_t>(0.75), uint_t(0));
+    ASSERT_EQ(from_double<uint_t>(123.9), uint_t(123));
+    ASSERT_EQ(from_double<uint_t>(1e30), uint_t(0xc9f2c9cd04675ull) << 48);
+    ASSERT_EQ(from_double<uint_t>(std::ldexp(1.0, 64) + std::ldexp(1.0, 12)), (uint_t(1) << 64) + uint_t(4096));
+
+    if constexpr (std::numeric_limits<long double>::digits >= 64) {
+        ASSERT_EQ(from_floating<uint_t>(std::ldexp(1.0L, 62) + 3.0L), (uint_t(1) << 62) + uint_t(3));
+    }
+
+    // negative, NaN and too big values
+
+    ASSERT_EQ(from_double<uint_t>(-5.5), uint_t(0));
+    ASSERT_EQ(from_double<uint_t>(std::numeric_limits<double>::quiet_NaN()), uint_t(0));
+    ASSERT_EQ(from_double<uint_t>(std::ldexp(1.0, static_cast<int>(bit_count_v<uint_t>))), uint_t(-1));
+    ASSERT_EQ(from_double<uint_t>(std::numeric_limits<double>::infinity()), uint_t(-1));
+
+    // round trip of values exactly representable in double
+
+    for (size_t shift = 0; shift < bit_count_v<uint_t> - 53; shift += 7) {
+
+        const uint_t value = uint_t(0x1f2e3d4c5b6a7ull) << shift;
+        ASSERT_EQ(from_double<uint_t>(to_double(value)), value);
+    }
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+template<typename int_t>
+void run_signed_from_floating_tests()
+{
+    static_assert(from_double<int_t>(-123.9) == int_t(-123));
+
+    ASSERT_EQ(from_double<int_t>(-0.9), int_t(0));
+    ASSERT_EQ(from_double<int_t>(-123.9), int_t(-123));
+    ASSERT_EQ(from_double<int_t>(-1e30), -(int_t(0xc9f2c9cd04675ull) << 48));
+    ASSERT_EQ(from_double<int_t>(std::numeric_limits<double>::quiet_NaN()), int_t(0));
+
+    // out of range values saturate
+
+    ASSERT_EQ(from_double<int_t>(std::ldexp(1.0, static_cast<int>(bit_count_v<int_t>) - 1)), std::numeric_limits<int_t>::max());
+    ASSERT_EQ(from_double<int_t>(-std::ldexp(1.0, static_cast<int>(bit_count_v<int_t>) - 1)), std::numeric_limits<int_t>::min());
+    ASSERT_EQ(from_double<int_t>(-std::numeric_limits<double>::infinity()), std::numeric_limits<int_t>::min());
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// float_tests
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+TEST(float_tests, family_128_unsigned_to_double_rounding)
+{
+    run_unsigned_to_double_rounding_tests<uint128_t>();
+    run_unsigned_to_double_rounding_tests<uint32x4_t>();
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+TEST(float_tests, family_256_unsigned_to_double_rounding)
+{
+    run_unsigned_to_double_rounding_tests<uint256_t>();
+    run_unsigned_to_double_rounding_tests<uint32x8_t>();
+    run_unsigned_to_double_rounding_tests<uint64x4_t>();
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+TEST(float_tests, family_128_and_256_unsigned_to_float_and_long_double)
+{
+    run_unsigned_to_float_tests<uint128_t>();
+    run_unsigned_to_float_tests<uint32x4_t>();
+    run_unsigned_to_float_tests<uint256_t>();
+    run_unsigned_to_long_double_tests<uint128_t>();
+    run_unsigned_to_long_double_tests<uint32x4_t>();
+    run_unsigned_to_long_double_tests<uint256_t>();
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+TEST(float_tests, family_128_and_256_signed_to_floating)
+{
+    run_signed_to_floating_tests<uint128_t, int128_t>();
+    run_signed_to_floating_tests<uint32x4_t, int32x4_t>();
+    run_signed_to_floating_tests<uint256_t, int256_t>();
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+TEST(float_tests, family_128_and_256_signed_and_unsigned_from_floating)
+{
+    run_unsigned_from_floating_tests<uint128_t>();
+    run_unsigned_from_floating_tests<uint32x4_t>();
+    run_unsigned_from_floating_tests<uint256_t>();
+    run_signed_from_floating_tests<int128_t>();
+    run_signed_from_floating_tests<int32x4_t>();
+    run_signed_from_floating_tests<int256_t>();
+}
+
+} // namespace slim
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// float_tests.cpp
+////////////////////////////////////////////////////////////////////////////////////////////////////
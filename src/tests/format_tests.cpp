@@ -0,0 +1,179 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// Simple Long Integer Math for C++
+// version 2.0
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// Licensed under the MIT License <http://opensource.org/licenses/MIT>.
+// SPDX-License-Identifier: MIT
+//
+// Copyright (c) 2020-2026 Yury Kalmykov <y_kalmykov@mail.ru>.
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "type_sets.h"
+
+#include <slimcpplib/long_format.h>
+
+#include <gtest/gtest.h>
+
+#include <iterator>
+#include <string>
+#include <string_view>
+
+using namespace slim::literals;
+
+namespace slim
+{
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// standalone functions
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+template<typename type_t>
+std::string format_with_spec(std::string_view spec_text, const type_t& value)
+{
+    using uint_t = make_unsigned_t<type_t>;
+
+    impl::format_spec_t<char> spec;
+    auto it = spec_text.begin();
+
+    EXPECT_TRUE(impl::parse_format_spec(it, spec_text.end(), spec)) << spec_text;
+    EXPECT_EQ(it, spec_text.end()) << spec_text;
+
+    const bool negative = value < type_t(0);
+    std::string result;
+    impl::write_format(std::back_inserter(result), negative ? uint_t(-value) : uint_t(value), negative, spec);
+
+    return result;
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+template<typename uint_t>
+void run_unsigned_format_tests()
+{
+    ASSERT_EQ(format_with_spec("", uint_t(0)), "0");
+    ASSERT_EQ(format_with_spec("d", uint_t(12345)), "12345");
+    ASSERT_EQ(format_with_spec("x", uint_t(0xabcdef)), "abcdef");
+    ASSERT_EQ(format_with_spec("X", uint_t(0xabcdef)), "ABCDEF");
+    ASSERT_EQ(format_with_spec("o", uint_t(8)), "10");
+    ASSERT_EQ(format_with_spec("b", uint_t(5)), "101");
+    ASSERT_EQ(format_with_spec("x", uint_t(-1)), std::string(bit_count_v<uint_t> / 4, 'f'));
+
+    // alternate form prefixes, octal zero has no prefix
+
+    ASSERT_EQ(format_with_spec("#x", uint_t(255)), "0xff");
+    ASSERT_EQ(format_with_spec("#X", uint_t(255)), "0XFF");
+    ASSERT_EQ(format_with_spec("#o", uint_t(8)), "010");
+    ASSERT_EQ(format_with_spec("#o", uint_t(0)), "0");
+    ASSERT_EQ(format_with_spec("#b", uint_t(2)), "0b10");
+    ASSERT_EQ(format_with_spec("#B", uint_t(2)), "0B10");
+
+    // sign of non-negative values
+
+    ASSERT_EQ(format_with_spec("+", uint_t(42)), "+42");
+    ASSERT_EQ(format_with_spec(" ", uint_t(42)), " 42");
+    ASSERT_EQ(format_with_spec("-", uint_t(42)), "42");
+
+    // width, fill, alignment and zero padding
+
+    ASSERT_EQ(format_with_spec("6", uint_t(42)), "    42");
+    ASSERT_EQ(format_with_spec("<6", uint_t(42)), "42    ");
+    ASSERT_EQ(format_with_spec("^6", uint_t(42)), "  42  ");
+    ASSERT_EQ(format_with_spec("^7", uint_t(42)), "  42   ");
+    ASSERT_EQ(format_with_spec("*>6", uint_t(42)), "****42");
+    ASSERT_EQ(format_with_spec("06", uint_t(42)), "000042");
+    ASSERT_EQ(format_with_spec("+#010x", uint_t(255)), "+0x00000ff");
+    ASSERT_EQ(format_with_spec("<06", uint_t(42)), "42    ");
+    ASSERT_EQ(format_with_spec("1", uint_t(12345)), "12345");
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+template<typename int_t>
+void run_signed_format_tests()
+{
+    ASSERT_EQ(format_with_spec("", int_t(-42)), "-42");
+    ASSERT_EQ(format_with_spec("+", int_t(-42)), "-42");
+    ASSERT_EQ(format_with_spec(" ", int_t(-42)), "-42");
+    ASSERT_EQ(format_with_spec("#x", int_t(-255)), "-0xff");
+    ASSERT_EQ(format_with_spec("08", int_t(-42)), "-0000042");
+    ASSERT_EQ(format_with_spec("_^9", int_t(-42)), "___-42___");
+    ASSERT_EQ(format_with_spec("b", std::numeric_limits<int_t>::min()), "-1" + std::string(bit_count_v<int_t> - 1, '0'));
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void run_invalid_format_spec_tests()
+{
+    for (std::string_view spec_text : { "c", "e", ".3", "L", "xx", "{}", "5.2d" }) {
+
+        impl::format_spec_t<char> spec;
+        auto it = spec_text.begin();
+
+        ASSERT_FALSE(impl::parse_format_spec(it, spec_text.end(), spec)) << spec_text;
+    }
+
+    // parsing stops at the closing brace
+
+    std::string_view spec_text = "x}tail";
+    impl::format_spec_t<char> spec;
+    auto it = spec_text.begin();
+
+    ASSERT_TRUE(impl::parse_format_spec(it, spec_text.end(), spec));
+    ASSERT_EQ(*it, '}');
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// format_tests
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+TEST(format_tests, family_128_and_256_unsigned_format_spec)
+{
+    run_unsigned_format_tests<uint128_t>();
+    run_unsigned_format_tests<uint32x4_t>();
+    run_unsigned_format_tests<uint256_t>();
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+TEST(format_tests, family_128_and_256_signed_format_spec)
+{
+    run_signed_format_tests<int128_t>();
+    run_signed_format_tests<int32x4_t>();
+    run_signed_format_tests<int256_t>();
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+TEST(format_tests, invalid_format_spec)
+{
+    run_invalid_format_spec_tests();
+}
+
+#if defined(__cpp_lib_format)
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+TEST(format_tests, std_format)
+{
+    ASSERT_EQ(std::format("{}", 340282366920938463463374607431768211455_ui128), "340282366920938463463374607431768211455");
+    ASSERT_EQ(std::format("{:#x}", 0xfedcba9876543210fedcba9876543210_ui128), "0xfedcba9876543210fedcba9876543210");
+    ASSERT_EQ(std::format("{:*^10}|{:+}", -42_si128, 42_si256), "***-42****|+42");
+    ASSERT_EQ(std::format(L"{:08X}", uint128_t(0xbeef)), L"0000BEEF");
+}
+
+#endif // defined(__cpp_lib_format)
+
+} // namespace slim
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// format_tests.cpp
+////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,118 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// Simple Long Integer Math for C++
+// version 2.0
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// Licensed under the MIT License <http://opensource.org/licenses/MIT>.
+// SPDX-License-Identifier: MIT
+//
+// Copyright (c) 2020-2026 Yury Kalmykov <y_kalmykov@mail.ru>.
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "type_sets.h"
+
+#include <slimcpplib/long_io.h>
+
+#include <gtest/gtest.h>
+
+#include <sstream>
+
+namespace slim
+{
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// standalone functions
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+template<typename uint_t>
+void run_ilog2_tests()
+{
+    static_assert(ilog2(uint_t(0)) == 0);
+    static_assert(ilog2(uint_t(1)) == 0);
+    static_assert(ilog2(uint_t(2)) == 1);
+    static_assert(ilog2(uint_t(3)) == 1);
+    static_assert(ilog2(uint_t(-1)) == bit_count_v<uint_t> - 1);
+
+    for (size_t shift = 0; shift < bit_count_v<uint_t>; ++shift) {
+
+        ASSERT_EQ(ilog2(uint_t(1) << shift), shift);
+        ASSERT_EQ(ilog2((uint_t(2) << shift) - uint_t(1)), shift);
+    }
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+template<typename uint_t>
+void run_ilog10_tests()
+{
+    static_assert(ilog10(uint_t(0)) == 0);
+    static_assert(ilog10(uint_t(9)) == 0);
+    static_assert(ilog10(uint_t(10)) == 1);
+    static_assert(decimal_digits(uint_t(0)) == 1);
+    static_assert(decimal_digits(uint_t(-1)) == std::numeric_limits<uint_t>::digits10 + 1);
+
+    // every power of ten and its neighbours
+
+    uint_t power = 1;
+
+    for (size_t exponent = 0; exponent <= std::numeric_limits<uint_t>::digits10; ++exponent) {
+
+        ASSERT_EQ(ilog10(power), exponent);
+        ASSERT_EQ(decimal_digits(power), exponent + 1);
+        ASSERT_EQ(ilog10(power + uint_t(1)), exponent);
+
+        if (exponent > 0) {
+            ASSERT_EQ(ilog10(power - uint_t(1)), exponent - 1);
+        }
+
+        power *= uint_t(10);
+    }
+
+    // every bit length, checked against the formatted length
+
+    for (size_t shift = 0; shift < bit_count_v<uint_t>; ++shift) {
+
+        for (const uint_t& value : { uint_t(1) << shift, (uint_t(2) << shift) - uint_t(1) }) {
+
+            std::ostringstream stream;
+            stream << value;
+
+            ASSERT_EQ(decimal_digits(value), stream.str().size());
+        }
+    }
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// ilog_tests
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+TEST(ilog_tests, family_128_and_256_ilog2)
+{
+    run_ilog2_tests<uint128_t>();
+    run_ilog2_tests<uint32x4_t>();
+    run_ilog2_tests<uint256_t>();
+    run_ilog2_tests<uint32x8_t>();
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+TEST(ilog_tests, family_128_and_256_ilog10_and_decimal_digits)
+{
+    run_ilog10_tests<uint128_t>();
+    run_ilog10_tests<uint32x4_t>();
+    run_ilog10_tests<uint256_t>();
+    run_ilog10_tests<uint32x8_t>();
+    run_ilog10_tests<uint64x4_t>();
+}
+
+} // namespace slim
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// ilog_tests.cpp
+////////////////////////////////////////////////////////////////////////////////////////////////////
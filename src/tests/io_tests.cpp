@@ -18,13 +18,67 @@
 
 #include <gtest/gtest.h>
 
+#include <algorithm>
+#include <iomanip>
 #include <sstream>
+#include <streambuf>
 #include <string>
 
 using namespace slim::literals;
 
 namespace slim
 {
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// chunked_streambuf class
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+// input buffer, that exposes only a few characters at a time or none at all when chunk size is zero
+
+class chunked_streambuf : public std::streambuf
+{
+public:
+    chunked_streambuf(std::string text, size_t chunk_size)
+    : text(std::move(text))
+    , chunk_size(chunk_size)
+    {
+    }
+
+protected:
+    int_type underflow() override
+    {
+        if (position == text.size())
+            return traits_type::eof();
+
+        if (chunk_size != 0) {
+
+            const size_t size = std::min(chunk_size, text.size() - position);
+
+            setg(text.data() + position, text.data() + position, text.data() + position + size);
+            position += size;
+        }
+
+        return traits_type::to_int_type(chunk_size != 0 ? *gptr() : text[position]);
+    }
+
+    int_type uflow() override
+    {
+        if (chunk_size != 0)
+            return std::streambuf::uflow();
+
+        if (position == text.size())
+            return traits_type::eof();
+
+        return traits_type::to_int_type(text[position++]);
+    }
+
+private:
+    std::string text;
+    size_t chunk_size = 0;
+    size_t position = 0;
+};
+
+
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 // standalone functions
 ////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -412,6 +466,38 @@ void run_octal_output_tests()
 
 
 
+////////////////////////////////////////////////////////////////////////////////////////////////////
+template<typename uint_t, typename int_t>
+void run_binary_output_and_input_tests()
+{
+    std::ostringstream binary_stream;
+
+    binary_stream << bin << uint_t(0) << ' ' << uint_t(5) << ' ' << int_t(-5) << ' ' << 5;
+    ASSERT_EQ(binary_stream.str(), "0 101 -101 5");
+
+    binary_stream.str("");
+    binary_stream << std::showbase << std::uppercase << uint_t(6) << ' ' << std::nouppercase << uint_t(6);
+    ASSERT_EQ(binary_stream.str(), "0B110 0b110");
+
+    binary_stream.str("");
+    binary_stream << std::noshowbase << uint_t(-1) << ' ' << std::hex << uint_t(255) << ' ' << std::dec << uint_t(5);
+    ASSERT_EQ(binary_stream.str(), std::string(bit_count_v<uint_t>, '1') + " ff 5");
+
+    // binary input stops at the first non binary digit
+
+    std::istringstream input_stream("1012 -110");
+    uint_t unsigned_value = 0;
+    int_t signed_value = 0;
+    input_stream >> bin >> unsigned_value;
+    ASSERT_EQ(unsigned_value, uint_t(5));
+    ASSERT_EQ(input_stream.peek(), '2');
+    input_stream.ignore();
+    input_stream >> signed_value;
+    ASSERT_EQ(signed_value, int_t(-6));
+}
+
+
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 template<typename uint_t>
 void run_stream_format_switching_tests()
@@ -478,6 +564,61 @@ void run_unsigned_input_overflow_tests()
 
 
 
+////////////////////////////////////////////////////////////////////////////////////////////////////
+template<typename uint_t, typename int_t>
+void run_buffer_boundary_input_tests()
+{
+    const std::string text = "340282366920938463463374607431768211455 -123456789012345678901234567890 0x";
+
+    // values split between refills of the get area and unbuffered input give the same result
+
+    for (size_t chunk_size : { 0, 1, 3, 7, 64 }) {
+
+        chunked_streambuf buffer(text, chunk_size);
+        std::istream stream(&buffer);
+
+        uint_t unsigned_value;
+        int_t signed_value;
+        uint_t zero_value;
+
+        stream >> unsigned_value >> signed_value >> zero_value;
+
+        ASSERT_FALSE(stream.fail()) << chunk_size;
+        ASSERT_EQ(unsigned_value, uint_t(-1) >> (bit_count_v<uint_t> - 128)) << chunk_size;
+        ASSERT_EQ(signed_value, -int_t(123456789012345678ULL) * int_t(1000000000000ULL) - int_t(901234567890ULL)) << chunk_size;
+        ASSERT_EQ(zero_value, uint_t(0)) << chunk_size;
+        ASSERT_EQ(stream.get(), 'x') << chunk_size;
+    }
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+template<typename uint_t>
+void run_wide_fill_output_tests()
+{
+    // fill wider than the local buffer is written in several chunks
+
+    std::ostringstream stream;
+
+    stream << std::setw(300) << std::setfill('*') << uint_t(42);
+    ASSERT_EQ(stream.str(), std::string(298, '*') + "42");
+
+    stream.str("");
+    stream << std::left << std::setw(1000) << uint_t(42) << '|';
+    ASSERT_EQ(stream.str(), "42" + std::string(998, '*') + "|");
+
+    stream.str("");
+    stream << std::internal << std::showbase << std::hex << std::setw(500) << uint_t(255);
+    ASSERT_EQ(stream.str(), "0x" + std::string(496, '*') + "ff");
+
+    stream.str("");
+    stream << std::right << std::setw(3) << uint_t(255) << std::setw(0) << uint_t(1);
+    ASSERT_EQ(stream.str(), "0xff0x1");
+}
+
+
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 // io_tests
 ////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -529,6 +670,18 @@ TEST(io_tests, octal_output)
 
 
 
+////////////////////////////////////////////////////////////////////////////////////////////////////
+TEST(io_tests, binary_output_and_input)
+{
+    run_binary_output_and_input_tests<uint128_t, int128_t>();
+    run_binary_output_and_input_tests<uint32x4_t, int32x4_t>();
+    run_binary_output_and_input_tests<uint256_t, int256_t>();
+    run_binary_output_and_input_tests<uint32x8_t, int32x8_t>();
+    run_binary_output_and_input_tests<uint64x4_t, int64x4_t>();
+}
+
+
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 TEST(io_tests, stream_format_switching)
 {
@@ -666,6 +819,25 @@ TEST(io_tests, family_256_signed_and_unsigned_stream_state_contract)
     run_stream_state_contract_tests<uint64x4_t, int64x4_t>();
 }
 
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+TEST(io_tests, family_128_and_256_buffer_boundary_input)
+{
+    run_buffer_boundary_input_tests<uint128_t, int128_t>();
+    run_buffer_boundary_input_tests<uint256_t, int256_t>();
+    run_buffer_boundary_input_tests<uint32x8_t, int32x8_t>();
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+TEST(io_tests, family_128_and_256_wide_fill_output)
+{
+    run_wide_fill_output_tests<uint128_t>();
+    run_wide_fill_output_tests<uint256_t>();
+}
+
 } // namespace slim
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,134 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// Simple Long Integer Math for C++
+// version 2.0
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// Licensed under the MIT License <http://opensource.org/licenses/MIT>.
+// SPDX-License-Identifier: MIT
+//
+// Copyright (c) 2020-2026 Yury Kalmykov <y_kalmykov@mail.ru>.
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "type_sets.h"
+
+#include <gtest/gtest.h>
+
+#include <compare>
+#include <random>
+
+namespace slim
+{
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// standalone functions
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+template<typename type_t>
+type_t make_mixed_width_value(std::mt19937_64& engine)
+{
+    using native_t = native_word_t<type_t>;
+
+    typename type_t::native_array_t digits{};
+
+    // mix of zero, all-ones and random digits exercises carry and borrow chains
+
+    for (native_t& digit : digits) {
+
+        switch (engine() % 4) {
+        case 0:  digit = native_t(0); break;
+        case 1:  digit = native_t(~native_t(0)); break;
+        default: digit = static_cast<native_t>(engine()); break;
+        }
+    }
+
+    return type_t(digits);
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+template<typename long_t, typename short_t>
+void run_mixed_width_arithmetic_tests()
+{
+    // carry propagates through all upper digits
+
+    static_assert(long_t(-1) + short_t(1) == long_t(0));
+    static_assert(long_t(short_t(-1)) + short_t(1) == long_t(short_t(-1)) + long_t(short_t(1)));
+    static_assert(long_t(0) - short_t(1) == long_t(0) - long_t(short_t(1)));
+    static_assert(long_t(3) * short_t(5) == long_t(15));
+
+    std::mt19937_64 engine(28);
+
+    for (size_t n = 0; n < 1000; ++n) {
+
+        const long_t value1 = make_mixed_width_value<long_t>(engine);
+        const short_t value2 = make_mixed_width_value<short_t>(engine);
+        const long_t widened = long_t(value2);
+
+        // results match operations on the widened operand
+
+        long_t sum = value1;
+        sum += value2;
+        ASSERT_EQ(sum, value1 + widened);
+        ASSERT_EQ(value1 + value2, value1 + widened);
+
+        long_t difference = value1;
+        difference -= value2;
+        ASSERT_EQ(difference, value1 - widened);
+        ASSERT_EQ(value1 - value2, value1 - widened);
+
+        long_t product = value1;
+        product *= value2;
+        ASSERT_EQ(product, value1 * widened);
+        ASSERT_EQ(value1 * value2, value1 * widened);
+
+        // comparisons match comparisons with the widened operand
+
+        ASSERT_EQ(value1 == value2, value1 == widened);
+        ASSERT_EQ(widened == value2, true);
+        ASSERT_EQ(value1 <=> value2, value1 <=> widened);
+        ASSERT_EQ(value2 <=> value1, widened <=> value1);
+        ASSERT_EQ(value1 < value2, value1 < widened);
+        ASSERT_EQ(value2 < value1, widened < value1);
+    }
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// mixed_width_tests
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+TEST(mixed_width_tests, family_256_and_128_unsigned)
+{
+    run_mixed_width_arithmetic_tests<uint256_t, uint128_t>();
+    run_mixed_width_arithmetic_tests<uint32x8_t, uint32x4_t>();
+    run_mixed_width_arithmetic_tests<uint32x8_t, long_uint_t<uint32_t, 2>>();
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+TEST(mixed_width_tests, family_256_and_128_signed)
+{
+    run_mixed_width_arithmetic_tests<int256_t, int128_t>();
+    run_mixed_width_arithmetic_tests<int32x8_t, int32x4_t>();
+    run_mixed_width_arithmetic_tests<int32x8_t, long_int_t<uint32_t, 2>>();
+
+    // negative values are sign extended
+
+    ASSERT_EQ(int256_t(5) + int128_t(-7), int256_t(-2));
+    ASSERT_EQ(int256_t(5) - int128_t(-7), int256_t(12));
+    ASSERT_EQ(int256_t(5) * int128_t(-7), int256_t(-35));
+    ASSERT_EQ(int256_t(-5) * int128_t(-7), int256_t(35));
+    ASSERT_TRUE(int256_t(-1) == int128_t(-1));
+    ASSERT_TRUE(int128_t(-1) < int256_t(0));
+}
+
+} // namespace slim
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// mixed_width_tests.cpp
+////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,137 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// Simple Long Integer Math for C++
+// version 2.0
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// Licensed under the MIT License <http://opensource.org/licenses/MIT>.
+// SPDX-License-Identifier: MIT
+//
+// Copyright (c) 2020-2026 Yury Kalmykov <y_kalmykov@mail.ru>.
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+#include "type_sets.h"
+
+#include <slimcpplib/long_parallel.h>
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <atomic>
+#include <limits>
+#include <vector>
+#include <random>
+
+namespace slim
+{
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// standalone functions
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+template<typename type_t>
+void run_parallel_tests(thread_pool& pool)
+{
+    for (size_t count : { 0, 1, 1000, 20000, 100003 }) {
+
+        for (uint_t used_words : { uint_t(1), word_count<type_t> }) {
+
+            std::mt19937_64 engine(count + used_words);
+            std::vector<type_t> values(count);
+
+            for (type_t& value : values)
+                value = make_random_value<type_t>(engine, used_words, 2);
+
+            std::vector<type_t> expected = values;
+            std::sort(expected.begin(), expected.end());
+
+            std::vector<type_t> sorted = values;
+            parallel_radix_sort(pool, std::span<type_t>(sorted));
+            EXPECT_EQ(sorted, expected);
+
+            type_t sum = 0;
+
+            for (const type_t& value : values)
+                sum += value;
+
+            EXPECT_EQ(parallel_reduce(pool, std::span<const type_t>(values)), sum);
+        }
+    }
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void run_parallel_dot_tests(thread_pool& pool)
+{
+    std::mt19937_64 engine(48);
+
+    for (size_t count : { 0, 1, 1000, 100003 }) {
+
+        std::vector<int64_t> values1(count);
+        std::vector<int64_t> values2(count);
+
+        for (size_t n = 0; n < count; ++n) {
+
+            values1[n] = n % 5 == 0 ? std::numeric_limits<int64_t>::min() : static_cast<int64_t>(engine());
+            values2[n] = n % 3 == 0 ? std::numeric_limits<int64_t>::min() : static_cast<int64_t>(engine());
+        }
+
+        // exact partial sums give the same result for every number of threads
+
+        EXPECT_EQ(parallel_dot_exact(pool, std::span<const int64_t>(values1), std::span<const int64_t>(values2)), dot_exact(std::span<const int64_t>(values1), std::span<const int64_t>(values2)));
+    }
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// parallel_tests
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+TEST(parallel_tests, thread_pool)
+{
+    for (uint_t thread_count : { 1, 2, 4, 7 }) {
+
+        thread_pool pool(thread_count);
+        EXPECT_EQ(pool.size(), thread_count);
+
+        // every index is executed exactly once, also by consecutive runs
+
+        for (uint_t task_count : { 0, 1, 3, 100 }) {
+
+            std::vector<std::atomic<uint_t>> calls(task_count);
+
+            pool.run(task_count, [&calls](uint_t index) noexcept { calls[index].fetch_add(1); });
+            pool.run(task_count, [&calls](uint_t index) noexcept { calls[index].fetch_add(1); });
+
+            EXPECT_TRUE(std::all_of(calls.begin(), calls.end(), [](const std::atomic<uint_t>& count) { return count.load() == 2; }));
+        }
+    }
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+TEST(parallel_tests, family_128_and_256_radix_sort_reduce_and_dot)
+{
+    for (uint_t thread_count : { 1, 3, 8 }) {
+
+        thread_pool pool(thread_count);
+
+        run_parallel_tests<uint128_t>(pool);
+        run_parallel_tests<int128_t>(pool);
+        run_parallel_tests<uint256_t>(pool);
+        run_parallel_tests<int256_t>(pool);
+        run_parallel_tests<uint32x4_t>(pool);
+        run_parallel_dot_tests(pool);
+    }
+}
+
+} // namespace slim
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// parallel_tests.cpp
+////////////////////////////////////////////////////////////////////////////////////////////////////
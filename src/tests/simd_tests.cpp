@@ -0,0 +1,253 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// Simple Long Integer Math for C++
+// version 2.0
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// Licensed under the MIT License <http://opensource.org/licenses/MIT>.
+// SPDX-License-Identifier: MIT
+//
+// Copyright (c) 2020-2026 Yury Kalmykov <y_kalmykov@mail.ru>.
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "type_sets.h"
+
+#include <slimcpplib/long_simd.h>
+
+#include <gtest/gtest.h>
+
+#include <functional>
+#include <random>
+#include <vector>
+
+using namespace slim::literals;
+
+namespace slim
+{
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// standalone functions
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+template<typename type_t>
+void run_array_kernel_tests()
+{
+    std::mt19937_64 engine(42);
+
+    // lengths cover empty arrays, whole vector blocks and scalar tails
+
+    for (size_t count = 0; count < 40; ++count) {
+
+        std::vector<type_t> values1(count);
+        std::vector<type_t> values2(count);
+
+        for (size_t n = 0; n < count; ++n) {
+
+            values1[n] = make_random_value<type_t>(engine, word_count<type_t>, 2);
+            values2[n] = n % 5 == 0 ? ~values1[n] : make_random_value<type_t>(engine, word_count<type_t>, 2);
+        }
+
+        std::vector<type_t> sums(count);
+        std::vector<type_t> differences(count);
+        std::vector<type_t> products(count);
+
+        add_n<type_t>(sums, values1, values2);
+        sub_n<type_t>(differences, values1, values2);
+        mul_n<type_t>(products, values1, values2);
+
+        for (size_t n = 0; n < count; ++n) {
+
+            ASSERT_EQ(sums[n], values1[n] + values2[n]);
+            ASSERT_EQ(differences[n], values1[n] - values2[n]);
+            ASSERT_EQ(products[n], values1[n] * values2[n]);
+        }
+
+        // result may be the same array as operand
+
+        std::vector<type_t> accumulated = values1;
+
+        add_n<type_t>(accumulated, accumulated, values2);
+        ASSERT_EQ(accumulated, sums);
+
+        sub_n<type_t>(accumulated, accumulated, values2);
+        ASSERT_EQ(accumulated, values1);
+
+        mul_n<type_t>(accumulated, accumulated, values2);
+        ASSERT_EQ(accumulated, products);
+    }
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void run_radix52_tests()
+{
+    std::mt19937_64 engine(44);
+
+    for (size_t n = 0; n < 1000; ++n) {
+
+        const uint256_t value1 = make_random_value<uint256_t>(engine, word_count<uint256_t>, 2);
+        const uint256_t value2 = make_random_value<uint256_t>(engine, word_count<uint256_t>, 2);
+
+        const impl::radix52_array_t digits1 = impl::to_radix52(value1);
+        const impl::radix52_array_t digits2 = impl::to_radix52(value2);
+
+        // digits fit 52 bits and convert back without loss
+
+        for (uint64_t digit : digits1)
+            ASSERT_EQ(digit & ~impl::radix52_mask, 0U);
+
+        ASSERT_EQ(impl::from_radix52(digits1), value1);
+        ASSERT_EQ(impl::from_radix52(impl::mul_radix52(digits1, digits2)), value1 * value2);
+    }
+}
+
+
+
+#if defined(__GNUC__) && defined(__x86_64__)
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+template<typename type_t, typename kernel_t, typename operation_t>
+void run_kernel_tests(kernel_t kernel, operation_t operation)
+{
+    constexpr size_t size = word_count<type_t>;
+
+    std::mt19937_64 engine(43);
+
+    const size_t count = 37;
+    std::vector<type_t> values1(count);
+    std::vector<type_t> values2(count);
+    std::vector<type_t> results(count);
+
+    for (size_t n = 0; n < count; ++n) {
+
+        values1[n] = make_random_value<type_t>(engine, word_count<type_t>, 2);
+        values2[n] = make_random_value<type_t>(engine, word_count<type_t>, 2);
+    }
+
+    const size_t processed = kernel(reinterpret_cast<uint64_t*>(results.data()), reinterpret_cast<const uint64_t*>(values1.data()),
+        reinterpret_cast<const uint64_t*>(values2.data()), count);
+
+    ASSERT_LE(processed, count);
+    ASSERT_GT(processed, count - 8);
+
+    for (size_t n = 0; n < processed; ++n)
+        ASSERT_EQ(results[n], operation(values1[n], values2[n])) << "size " << size << ", element " << n;
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+template<typename type_t>
+void run_vector_kernel_tests()
+{
+    constexpr uint_t size = word_count<type_t>;
+
+    // every kernel available on the running processor is checked, not only the selected one
+
+    if (cpu_features().avx2) {
+
+        run_kernel_tests<type_t>(impl::add_sub_n_avx2<size, false>, std::plus<type_t>());
+        run_kernel_tests<type_t>(impl::add_sub_n_avx2<size, true>, std::minus<type_t>());
+    }
+
+    if (cpu_features().avx512f) {
+
+        run_kernel_tests<type_t>(impl::add_sub_n_avx512<size, false>, std::plus<type_t>());
+        run_kernel_tests<type_t>(impl::add_sub_n_avx512<size, true>, std::minus<type_t>());
+    }
+
+    if constexpr (std::is_same_v<type_t, uint256_t>) {
+
+        if (cpu_features().avx512ifma)
+            run_kernel_tests<type_t>(impl::mul_n_ifma, std::multiplies<type_t>());
+    }
+}
+
+#endif // defined(__GNUC__) && defined(__x86_64__)
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// simd_tests
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+TEST(simd_tests, cpu_features)
+{
+    const cpu_features_t& features = cpu_features();
+
+    // features are detected once and depend on each other
+
+    EXPECT_EQ(&features, &cpu_features());
+
+    if (features.avx512bw || features.avx512vl || features.avx512ifma) {
+        EXPECT_TRUE(features.avx512f);
+    }
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+TEST(simd_tests, family_128_and_256_add_sub_mul_n)
+{
+    run_array_kernel_tests<uint128_t>();
+    run_array_kernel_tests<int128_t>();
+    run_array_kernel_tests<uint32x4_t>();
+    run_array_kernel_tests<uint256_t>();
+    run_array_kernel_tests<int256_t>();
+    run_array_kernel_tests<uint32x8_t>();
+    run_array_kernel_tests<long_uint_t<uint64_t, 8>>();
+    run_array_kernel_tests<long_uint_t<uint64_t, 16>>();
+    run_array_kernel_tests<long_uint_t<uint64_t, 128>>();
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+TEST(simd_tests, radix52_multiplication)
+{
+    constexpr uint256_t value = 0xfedcba9876543210fedcba9876543210fedcba9876543210fedcba9876543210_ui256;
+
+    static_assert(impl::from_radix52(impl::to_radix52(value)) == value);
+    static_assert(impl::from_radix52(impl::mul_radix52(impl::to_radix52(value), impl::to_radix52(value))) == value * value);
+
+    // scalar equivalents of IFMA instructions use low 52 bits of operands
+
+    static_assert(impl::madd52lo(1, impl::radix52_mask, 2) == impl::radix52_mask);
+    static_assert(impl::madd52hi(1, impl::radix52_mask, 2) == 2);
+    static_assert(impl::madd52lo(0, uint64_t(1) << 52 | 3, 5) == 15);
+
+    run_radix52_tests();
+}
+
+
+
+#if defined(__GNUC__) && defined(__x86_64__)
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+TEST(simd_tests, vector_kernels)
+{
+    static_assert(impl::element_top_mask<2, 4>() == 0b1010);
+    static_assert(impl::element_top_mask<4, 8>() == 0b10001000);
+
+    // carry of the low digit ripples through propagating digits up to the element boundary
+
+    static_assert(impl::resolve_carries(0b0001, 0b0110, 0b1000) == 0b1110);
+    static_assert(impl::resolve_carries(0b0001, 0b0100, 0b1000) == 0b0010);
+    static_assert(impl::resolve_carries(0b0001, 0b1110, 0b1010) == 0b0010);
+    static_assert(impl::resolve_carries(0b1000, 0b0000, 0b1000) == 0b0000);
+
+    run_vector_kernel_tests<uint128_t>();
+    run_vector_kernel_tests<uint256_t>();
+    run_vector_kernel_tests<long_uint_t<uint64_t, 8>>();
+    run_vector_kernel_tests<long_uint_t<uint64_t, 16>>();
+}
+
+#endif // defined(__GNUC__) && defined(__x86_64__)
+
+} // namespace slim
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// simd_tests.cpp
+////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,143 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// Simple Long Integer Math for C++
+// version 2.0
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// Licensed under the MIT License <http://opensource.org/licenses/MIT>.
+// SPDX-License-Identifier: MIT
+//
+// Copyright (c) 2020-2026 Yury Kalmykov <y_kalmykov@mail.ru>.
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+#include "type_sets.h"
+
+#include <slimcpplib/long_sort.h>
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <vector>
+#include <random>
+
+namespace slim
+{
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// standalone functions
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+template<typename type_t>
+void run_radix_sort_tests()
+{
+    std::mt19937_64 engine(45);
+
+    // buffer overload can throw only when histograms of longer integers are allocated
+
+    static_assert(noexcept(radix_sort(std::span<type_t>(), std::span<type_t>())) == (byte_count_v<type_t> <= 32));
+
+    for (size_t count : { 0, 1, 2, 3, 17, 256, 1000 }) {
+
+        for (uint_t used_words = 1; used_words <= word_count<type_t>; ++used_words) {
+
+            std::vector<type_t> values(count);
+
+            for (type_t& value : values)
+                value = make_random_value<type_t>(engine, used_words, 4);
+
+            std::vector<type_t> expected = values;
+            std::sort(expected.begin(), expected.end());
+
+            std::vector<type_t> sorted = values;
+            radix_sort(std::span<type_t>(sorted));
+            EXPECT_EQ(sorted, expected);
+
+            std::vector<type_t> buffer(count + 3);
+            sorted = values;
+            radix_sort(std::span<type_t>(sorted), std::span<type_t>(buffer));
+            EXPECT_EQ(sorted, expected);
+
+            // sorted input and equal keys
+
+            radix_sort(std::span<type_t>(sorted));
+            EXPECT_EQ(sorted, expected);
+
+            std::vector<type_t> equal(count, values.empty() ? type_t() : values.front());
+            radix_sort(std::span<type_t>(equal));
+            EXPECT_TRUE(std::all_of(equal.begin(), equal.end(), [&equal](const type_t& value) { return value == equal.front(); }));
+        }
+    }
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+template<typename type_t>
+void run_radix_sort_by_key_tests()
+{
+    std::mt19937_64 engine(46);
+
+    const size_t count = 1000;
+
+    std::vector<type_t> keys(count);
+    std::vector<size_t> positions(count);
+
+    // few distinct keys, so that stability is visible in the order of positions
+
+    for (size_t n = 0; n < count; ++n) {
+
+        keys[n] = make_random_value<type_t>(engine, 1, 4) >> (bit_count_v<type_t> - 4);
+        positions[n] = n;
+    }
+
+    std::vector<std::pair<type_t, size_t>> expected(count);
+
+    for (size_t n = 0; n < count; ++n)
+        expected[n] = { keys[n], positions[n] };
+
+    std::stable_sort(expected.begin(), expected.end(), [](const auto& pair1, const auto& pair2) { return pair1.first < pair2.first; });
+
+    radix_sort_by_key(std::span<type_t>(keys), std::span<size_t>(positions));
+
+    for (size_t n = 0; n < count; ++n) {
+
+        EXPECT_EQ(keys[n], expected[n].first);
+        EXPECT_EQ(positions[n], expected[n].second);
+    }
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// sort_tests
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+TEST(sort_tests, family_128_and_256_radix_sort)
+{
+    run_radix_sort_tests<uint128_t>();
+    run_radix_sort_tests<int128_t>();
+    run_radix_sort_tests<uint256_t>();
+    run_radix_sort_tests<int256_t>();
+    run_radix_sort_tests<uint32x4_t>();
+    run_radix_sort_tests<int32x8_t>();
+    run_radix_sort_tests<long_uint_t<uint64_t, 8>>();
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+TEST(sort_tests, family_128_and_256_radix_sort_by_key)
+{
+    run_radix_sort_by_key_tests<uint128_t>();
+    run_radix_sort_by_key_tests<int128_t>();
+    run_radix_sort_by_key_tests<int256_t>();
+    run_radix_sort_by_key_tests<long_int_t<uint64_t, 8>>();
+}
+
+} // namespace slim
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// sort_tests.cpp
+////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -22,10 +22,12 @@
 #include <functional>
 #include <limits>
 #include <numeric>
+#include <span>
 #include <tuple>
 #include <type_traits>
 #include <unordered_map>
 #include <unordered_set>
+#include <vector>
 
 namespace slim
 {
@@ -435,6 +437,85 @@ void run_signed_hash_tests()
 
 
 
+////////////////////////////////////////////////////////////////////////////////////////////////////
+template<typename uint_t>
+void run_hash_distribution_tests()
+{
+    constexpr uint_t prefix = uint_t(0x20010db800000000ull) << (bit_count_v<uint_t> - 64);
+
+    // std::hash and hash_n return the same values as hash
+
+    static_assert(std::hash<uint_t>()(prefix) == hash(prefix));
+
+    // keys sharing a prefix and differing in few low or high bits, as network addresses do
+
+    std::vector<uint_t> keys;
+
+    for (slim::uint_t n = 0; n < 0x8000; ++n) {
+
+        keys.push_back(prefix + uint_t(n));
+        keys.push_back(prefix ^ (uint_t(n + 1) << (bit_count_v<uint_t> - 32)));
+    }
+
+    std::vector<size_t> hashes(keys.size());
+    hash_n(std::span<const uint_t>(keys), std::span<size_t>(hashes));
+
+    for (size_t n = 0; n < keys.size(); ++n)
+        ASSERT_EQ(hashes[n], std::hash<uint_t>()(keys[n]));
+
+    std::vector<size_t> sorted = hashes;
+    std::sort(sorted.begin(), sorted.end());
+    EXPECT_EQ(std::adjacent_find(sorted.begin(), sorted.end()), sorted.end());
+
+    // words equal to the seed, keys or constants xored into them don't erase the other words of key
+
+    for (uint64_t constant : { 0xa0761d6478bd642full, 0xe7037ed1a0b428dbull, 0x8ebc6af09c88c6e3ull, 0x87799c3619718d0aull }) {
+
+        std::vector<size_t> constant_hashes;
+
+        for (slim::uint_t n = 0; n < 0x100; ++n) {
+
+            constant_hashes.push_back(hash(uint_t(constant) + (uint_t(n + 1) << 64)));
+            constant_hashes.push_back(hash(uint_t(constant) + (uint_t(n + 0x201) << (bit_count_v<uint_t> - 64))));
+            constant_hashes.push_back(hash((uint_t(constant) << 64) + uint_t(n + 0x100)));
+        }
+
+        std::sort(constant_hashes.begin(), constant_hashes.end());
+        EXPECT_EQ(std::adjacent_find(constant_hashes.begin(), constant_hashes.end()), constant_hashes.end());
+    }
+
+    // the same word in other position gives other hash
+
+    for (slim::uint_t n = 1; n < 0x100; ++n) {
+
+        EXPECT_NE(hash(uint_t(n)), hash(uint_t(n) << 64));
+        EXPECT_NE(hash(uint_t(n) + (uint_t(n + 1) << 64)), hash(uint_t(n + 1) + (uint_t(n) << 64)));
+    }
+
+    // low and high bits of hashes fill buckets evenly, 64 keys per bucket on average
+
+    constexpr size_t bucket_count = 1024;
+
+    std::vector<size_t> low_buckets(bucket_count);
+    std::vector<size_t> high_buckets(bucket_count);
+
+    for (size_t hash : hashes) {
+
+        ++low_buckets[hash % bucket_count];
+        ++high_buckets[hash >> (std::numeric_limits<size_t>::digits - 10)];
+    }
+
+    for (const std::vector<size_t>& buckets : { low_buckets, high_buckets }) {
+
+        const auto [min_bucket, max_bucket] = std::minmax_element(buckets.begin(), buckets.end());
+
+        EXPECT_GT(*min_bucket, 24u);
+        EXPECT_LT(*max_bucket, 112u);
+    }
+}
+
+
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 // stl_properties_tests
 ////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -578,6 +659,15 @@ TEST(stl_properties_tests, family_128_signed_hash)
 
 
 
+////////////////////////////////////////////////////////////////////////////////////////////////////
+TEST(stl_properties_tests, family_128_hash_distribution)
+{
+    run_hash_distribution_tests<uint128_t>();
+    run_hash_distribution_tests<uint32x4_t>();
+}
+
+
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 TEST(stl_properties_tests, family_256_signed_and_unsigned_stl_algorithms_and_containers)
 {
@@ -611,6 +701,15 @@ TEST(stl_properties_tests, family_256_signed_hash)
 
 
 
+////////////////////////////////////////////////////////////////////////////////////////////////////
+TEST(stl_properties_tests, family_256_hash_distribution)
+{
+    run_hash_distribution_tests<uint256_t>();
+    run_hash_distribution_tests<uint32x8_t>();
+}
+
+
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 TEST(stl_properties_tests, family_256_signed_and_unsigned_numeric_limits_usage)
 {
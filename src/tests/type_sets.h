@@ -17,6 +17,7 @@
 #include <slimcpplib/long_int.h>
 
 #include <cstddef>
+#include <random>
 
 using uint128_t = slim::uint128_t;
 using int128_t = slim::int128_t;
@@ -38,6 +39,35 @@ constexpr size_t word_count = std::tuple_size<typename uint_t::native_array_t>::
 template<typename type_t>
 constexpr size_t word_bits = sizeof(native_word_t<type_t>) * 8;
 
+// random integer: used_words low digits are random and one in special_period of them (none if it is
+// zero) is zero or all ones, so that carries and borrows cross digits; higher digits are all zero or
+// all ones, so that constant radix passes are skipped; shifted values are shifted right by a random
+// number of bits, so that values of every length appear
+
+template<typename type_t>
+type_t make_random_value(std::mt19937_64& engine, size_t used_words = word_count<type_t>, uint64_t special_period = 0, bool shifted = false)
+{
+    using native_t = native_word_t<type_t>;
+
+    typename type_t::native_array_t digits{};
+
+    const native_t fill = engine() % 2 == 0 ? native_t(0) : static_cast<native_t>(~native_t(0));
+
+    for (size_t n = 0; n < digits.size(); ++n) {
+
+        if (n >= used_words)
+            digits[n] = fill;
+        else if (special_period != 0 && engine() % special_period == 0)
+            digits[n] = engine() % 2 == 0 ? native_t(0) : static_cast<native_t>(~native_t(0));
+        else
+            digits[n] = static_cast<native_t>(engine());
+    }
+
+    const type_t value(digits);
+
+    return shifted ? value >> static_cast<slim::uint_t>(engine() % slim::bit_count_v<type_t>) : value;
+}
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 // End of file  type_sets.h
 ////////////////////////////////////////////////////////////////////////////////////////////////////
\ No newline at end of file
@@ -0,0 +1,211 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// Simple Long Integer Math for C++
+// version 2.0
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// Licensed under the MIT License <http://opensource.org/licenses/MIT>.
+// SPDX-License-Identifier: MIT
+//
+// Copyright (c) 2020-2026 Yury Kalmykov <y_kalmykov@mail.ru>.
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "type_sets.h"
+
+#include <slimcpplib/long_varint.h>
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <array>
+#include <vector>
+
+namespace slim
+{
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// standalone functions
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+template<typename type_t>
+constexpr size_t varint_max_size_v = std::max(leb128_max_size_v<type_t>, prefix_varint_max_size_v<type_t>);
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+template<typename type_t>
+constexpr bool check_varint_round_trip(const type_t& value) noexcept
+{
+    std::array<std::byte, varint_max_size_v<type_t>> buffer{};
+    type_t leb128_value = 0;
+    type_t prefix_value = 0;
+
+    const size_t leb128_size = encode_leb128(value, buffer);
+
+    if (leb128_size != slim::leb128_size(value) || decode_leb128(std::span<const std::byte>(buffer.data(), leb128_size), leb128_value) != leb128_size)
+        return false;
+
+    const size_t prefix_size = encode_prefix_varint(value, buffer);
+
+    if (prefix_size != prefix_varint_size(value) || prefix_varint_length<type_t>(buffer[0]) != prefix_size)
+        return false;
+
+    if (decode_prefix_varint(std::span<const std::byte>(buffer.data(), prefix_size), prefix_value) != prefix_size)
+        return false;
+
+    return leb128_value == value && prefix_value == value;
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+template<typename uint_t>
+void run_varint_tests()
+{
+    using int_t = make_signed_t<uint_t>;
+
+    static_assert(check_varint_round_trip(uint_t(0U)));
+    static_assert(check_varint_round_trip(~uint_t(0U)));
+    static_assert(check_varint_round_trip(int_t(-1)));
+    static_assert(check_varint_round_trip(std::numeric_limits<int_t>::min()));
+
+    // known LEB128 encodings
+
+    std::array<std::byte, varint_max_size_v<uint_t>> buffer{};
+
+    ASSERT_EQ(encode_leb128(uint_t(0U), buffer), 1U);
+    ASSERT_EQ(buffer[0], std::byte(0x00));
+    ASSERT_EQ(encode_leb128(uint_t(624485U), buffer), 3U);
+    ASSERT_EQ(buffer[0], std::byte(0xe5));
+    ASSERT_EQ(buffer[1], std::byte(0x8e));
+    ASSERT_EQ(buffer[2], std::byte(0x26));
+    ASSERT_EQ(encode_leb128(~uint_t(0U), buffer), leb128_max_size_v<uint_t>);
+
+    // zigzag keeps small magnitudes short
+
+    ASSERT_EQ(zigzag_encode(int_t(0)), uint_t(0U));
+    ASSERT_EQ(zigzag_encode(int_t(-1)), uint_t(1U));
+    ASSERT_EQ(zigzag_encode(int_t(1)), uint_t(2U));
+    ASSERT_EQ(zigzag_encode(std::numeric_limits<int_t>::min()), ~uint_t(0U));
+    ASSERT_EQ(zigzag_decode(uint_t(3U)), int_t(-2));
+    ASSERT_EQ(encode_leb128(int_t(-64), buffer), 1U);
+    ASSERT_EQ(buffer[0], std::byte(0x7f));
+
+    // prefix varint stores small values directly and large ones after length byte
+
+    constexpr size_t direct_limit = 256 - byte_count_v<uint_t>;
+
+    ASSERT_EQ(encode_prefix_varint(uint_t(direct_limit - 1), buffer), 1U);
+    ASSERT_EQ(buffer[0], std::byte(direct_limit - 1));
+    ASSERT_EQ(encode_prefix_varint(uint_t(direct_limit), buffer), 2U);
+    ASSERT_EQ(buffer[0], std::byte(0xff));
+    ASSERT_EQ(buffer[1], std::byte(direct_limit));
+    ASSERT_EQ(encode_prefix_varint(uint_t(0x1234U), buffer), 3U);
+    ASSERT_EQ(buffer[0], std::byte(0xfe));
+    ASSERT_EQ(buffer[1], std::byte(0x34));
+    ASSERT_EQ(buffer[2], std::byte(0x12));
+    ASSERT_EQ(encode_prefix_varint(~uint_t(0U), buffer), prefix_varint_max_size_v<uint_t>);
+    ASSERT_EQ(buffer[0], std::byte(direct_limit));
+
+    uint_t value = 0U;
+
+    for (uint_t n = 1U; n != 0U; n <<= 5) {
+
+        ASSERT_TRUE(check_varint_round_trip(n));
+        ASSERT_TRUE(check_varint_round_trip(n - 1U));
+        ASSERT_TRUE(check_varint_round_trip(int_t(n)));
+        ASSERT_TRUE(check_varint_round_trip(-int_t(n)));
+    }
+
+    // short buffers and malformed input are rejected without changing the value
+
+    ASSERT_EQ(encode_leb128(uint_t(624485U), std::span(buffer).first(2)), 0U);
+    ASSERT_EQ(encode_prefix_varint(uint_t(0x1234U), std::span(buffer).first(2)), 0U);
+
+    const std::array<std::byte, 2> truncated = { std::byte(0x80), std::byte(0x80) };
+
+    ASSERT_EQ(decode_leb128(truncated, value), 0U);
+    ASSERT_EQ(decode_prefix_varint(std::span(buffer).first(2), value), 0U);
+    ASSERT_EQ(value, uint_t(0U));
+
+    // the last LEB128 group may not carry bits above the type width
+
+    std::array<std::byte, leb128_max_size_v<uint_t> + 1> too_long;
+    too_long.fill(std::byte(0xff));
+
+    ASSERT_EQ(decode_leb128(too_long, value), 0U);
+
+    too_long[leb128_max_size_v<uint_t> - 1] = std::byte(0x7f);
+
+    ASSERT_EQ(decode_leb128(too_long, value), 0U);
+
+    too_long[leb128_max_size_v<uint_t> - 1] = std::byte((1U << (bit_count_v<uint_t> % 7)) - 1);
+
+    ASSERT_EQ(decode_leb128(too_long, value), leb128_max_size_v<uint_t>);
+    ASSERT_EQ(value, ~uint_t(0U));
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+template<typename type_t>
+void run_bulk_varint_tests()
+{
+    std::vector<type_t> values;
+
+    for (size_t n = 0; n < 40; ++n)
+        values.push_back((type_t(1U) << (n * 5)) * type_t(n % 3 == 0 ? -1 : 1) + type_t(n));
+
+    std::vector<std::byte> bytes(values.size() * varint_max_size_v<type_t>);
+    std::vector<type_t> decoded(values.size());
+
+    const size_t leb128_size = encode_leb128(std::span<const type_t>(values), bytes);
+
+    ASSERT_NE(leb128_size, 0U);
+    ASSERT_EQ(decode_leb128(std::span(bytes).first(leb128_size), std::span(decoded)), leb128_size);
+    ASSERT_EQ(decoded, values);
+
+    const size_t prefix_size = encode_prefix_varint(std::span(values), bytes);
+
+    ASSERT_NE(prefix_size, 0U);
+    ASSERT_EQ(decode_prefix_varint(std::span(bytes).first(prefix_size), std::span(decoded)), prefix_size);
+    ASSERT_EQ(decoded, values);
+
+    // missing tail of the last value fails the whole span
+
+    ASSERT_EQ(decode_prefix_varint(std::span(bytes).first(prefix_size - 1), std::span(decoded)), 0U);
+    ASSERT_EQ(encode_leb128(std::span(values), std::span(bytes).first(leb128_size - 1)), 0U);
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// varint_tests
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+TEST(varint_tests, family_128_and_256_encodings)
+{
+    run_varint_tests<uint128_t>();
+    run_varint_tests<uint32x4_t>();
+    run_varint_tests<uint256_t>();
+    run_varint_tests<uint32x8_t>();
+    run_varint_tests<uint64x4_t>();
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+TEST(varint_tests, family_128_and_256_bulk_encodings)
+{
+    run_bulk_varint_tests<uint128_t>();
+    run_bulk_varint_tests<int128_t>();
+    run_bulk_varint_tests<uint256_t>();
+    run_bulk_varint_tests<int64x4_t>();
+}
+
+} // namespace slim
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// varint_tests.cpp
+////////////////////////////////////////////////////////////////////////////////////////////////////
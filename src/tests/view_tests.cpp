@@ -0,0 +1,158 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// Simple Long Integer Math for C++
+// version 2.0
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// Licensed under the MIT License <http://opensource.org/licenses/MIT>.
+// SPDX-License-Identifier: MIT
+//
+// Copyright (c) 2020-2026 Yury Kalmykov <y_kalmykov@mail.ru>.
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "type_sets.h"
+
+#include <slimcpplib/long_view.h>
+
+#include <gtest/gtest.h>
+
+#include <array>
+#include <vector>
+#include <iterator>
+#include <numeric>
+#include <ranges>
+#include <vector>
+
+namespace slim
+{
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// standalone functions
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+template<typename uint_t>
+std::vector<std::byte> make_packed_bytes(const std::vector<uint_t>& values, size_t offset)
+{
+    // shift storage by offset bytes, so that values are not aligned
+
+    std::vector<std::byte> bytes(offset + values.size() * byte_count_v<uint_t>, std::byte(0xcc));
+
+    to_bytes_le(std::span(values), std::span(bytes).subspan(offset));
+
+    return bytes;
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+template<typename uint_t>
+constexpr bool check_view_compare() noexcept
+{
+    std::array<std::byte, byte_count_v<uint_t> * 2> bytes{};
+
+    to_bytes_le(uint_t(5U), std::span(bytes).template first<byte_count_v<uint_t>>());
+    to_bytes_le(uint_t(1U) << (bit_count_v<uint_t> - 1), std::span(bytes).template last<byte_count_v<uint_t>>());
+
+    const long_uint_view<uint_t> low(bytes.data());
+    const long_uint_view<uint_t> high(bytes.data() + byte_count_v<uint_t>);
+
+    return low == uint_t(5U) && low < high && high > uint_t(5U) && low + high == (uint_t(1U) << (bit_count_v<uint_t> - 1)) + 5U;
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+template<typename uint_t>
+void run_view_tests()
+{
+    using view_t = long_uint_view<uint_t>;
+    using range_t = long_uint_view_range<uint_t>;
+
+    static_assert(std::ranges::random_access_range<range_t>);
+    static_assert(std::ranges::sized_range<range_t>);
+    static_assert(std::random_access_iterator<typename range_t::iterator>);
+    static_assert(check_view_compare<uint_t>());
+
+    std::vector<uint_t> values;
+
+    for (size_t n = 0; n < 17; ++n)
+        values.push_back((uint_t(n + 1) << (bit_count_v<uint_t> - 8)) | uint_t(n * 0x1234567U));
+
+    for (size_t offset = 0; offset < 4; ++offset) {
+
+        const std::vector<std::byte> bytes = make_packed_bytes(values, offset);
+        const range_t range = as_long_uints<uint_t>(std::span(bytes).subspan(offset));
+
+        ASSERT_EQ(range.size(), values.size());
+
+        size_t index = 0;
+
+        for (const view_t value : range) {
+
+            ASSERT_EQ(value, values[index]);
+            ASSERT_EQ(value.load(), values[index]);
+            ASSERT_EQ(value.digit(view_t::size - 1), values[index].digits.back());
+            ++index;
+        }
+
+        ASSERT_EQ(index, values.size());
+        ASSERT_EQ(range[3], values[3]);
+        ASSERT_EQ(range.end() - range.begin(), static_cast<std::ptrdiff_t>(values.size()));
+        ASSERT_EQ(*(range.end() - 1), values.back());
+    }
+
+    // trailing bytes, that don't form a whole value, are ignored
+
+    std::vector<std::byte> bytes = make_packed_bytes(values, 1);
+    ASSERT_EQ(as_long_uints<uint_t>(bytes).size(), values.size());
+
+    const auto range = as_long_uints<uint_t>(std::span(bytes).subspan(1));
+    const view_t first = range[0];
+    const view_t second = range[1];
+
+    // arithmetic returns values and accepts views, values and native integers
+
+    ASSERT_EQ(first + second, values[0] + values[1]);
+    ASSERT_EQ(values[0] - second, values[0] - values[1]);
+    ASSERT_EQ(first * 3U, values[0] * 3U);
+    ASSERT_EQ(second / first, values[1] / values[0]);
+    ASSERT_EQ(second % uint_t(1000U), values[1] % 1000U);
+    ASSERT_EQ(first & second, values[0] & values[1]);
+    ASSERT_EQ(first | second, values[0] | values[1]);
+    ASSERT_EQ(first ^ values[1], values[0] ^ values[1]);
+    ASSERT_EQ(first << 3, values[0] << 3);
+    ASSERT_EQ(first >> 3, values[0] >> 3);
+    ASSERT_EQ(~first, ~values[0]);
+    ASSERT_EQ(-first, -values[0]);
+
+    // comparisons stop at the first different digit
+
+    ASSERT_TRUE(first < second);
+    ASSERT_TRUE(values[1] > first);
+    ASSERT_TRUE(first != second);
+    ASSERT_TRUE(first == range[0]);
+    ASSERT_EQ(std::ranges::max(range), values.back());
+    ASSERT_EQ(std::accumulate(range.begin(), range.end(), uint_t(0U)), std::accumulate(values.begin(), values.end(), uint_t(0U)));
+}
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// view_tests
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+TEST(view_tests, family_128_and_256_unaligned_views)
+{
+    run_view_tests<uint128_t>();
+    run_view_tests<uint32x4_t>();
+    run_view_tests<uint256_t>();
+    run_view_tests<uint32x8_t>();
+    run_view_tests<uint64x4_t>();
+}
+
+} // namespace slim
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// view_tests.cpp
+////////////////////////////////////////////////////////////////////////////////////////////////////